@@ -0,0 +1,131 @@
+/*
+ File: CPUFeatures.cpp
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Project
+#include <CPUFeatures.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+namespace
+{
+  /** \struct Features
+   * \brief Instruction sets supported by the processor, detected once.
+   *
+   */
+  struct Features
+  {
+      Features()
+      : sse41 {false}
+      , sse42 {false}
+      , pclmul{false}
+      , sha   {false}
+      , avx2  {false}
+      , bmi2  {false}
+      , avx512{false}
+      {
+#if defined(__x86_64__) || defined(__i386__)
+        unsigned int eax, ebx, ecx, edx;
+
+        bool avx = false, zmm = false;
+
+        if(__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+        {
+          sse41  = (ecx & bit_SSSE3) && (ecx & bit_SSE4_1);
+          sse42  = sse41 && (ecx & bit_SSE4_2);
+          pclmul = (ecx & bit_PCLMUL);
+
+          // the registers must also be saved by the operating system.
+          if((ecx & bit_OSXSAVE) && (ecx & bit_AVX))
+          {
+            unsigned int xcr0, xcr0High;
+            __asm__ ("xgetbv" : "=a"(xcr0), "=d"(xcr0High) : "c"(0));
+            avx = (xcr0 & 0x6) == 0x6;
+            zmm = (xcr0 & 0xE6) == 0xE6;
+          }
+        }
+
+        if(__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+        {
+          sha    = sse41 && (ebx & (1u << 29));
+          avx2   = avx && (ebx & (1u << 5));
+          bmi2   = (ebx & (1u << 8));
+          avx512 = zmm && (ebx & (1u << 16));
+        }
+#endif
+      }
+
+      bool sse41;  /** true if SSSE3 and SSE4.1 are supported.  */
+      bool sse42;  /** true if SSE4.2 is supported.             */
+      bool pclmul; /** true if PCLMULQDQ is supported.          */
+      bool sha;    /** true if SHA-NI is supported.             */
+      bool avx2;   /** true if AVX2 is supported.               */
+      bool bmi2;   /** true if BMI2 is supported.               */
+      bool avx512; /** true if AVX-512 Foundation is supported. */
+  };
+
+  const Features &features()
+  {
+    static const Features instance;
+    return instance;
+  }
+}
+
+//----------------------------------------------------------------
+bool CPUFeatures::hasSSE41()
+{
+  return features().sse41;
+}
+
+//----------------------------------------------------------------
+bool CPUFeatures::hasSSE42()
+{
+  return features().sse42;
+}
+
+//----------------------------------------------------------------
+bool CPUFeatures::hasPCLMUL()
+{
+  return features().pclmul;
+}
+
+//----------------------------------------------------------------
+bool CPUFeatures::hasSHA()
+{
+  return features().sha;
+}
+
+//----------------------------------------------------------------
+bool CPUFeatures::hasAVX2()
+{
+  return features().avx2;
+}
+
+//----------------------------------------------------------------
+bool CPUFeatures::hasBMI2()
+{
+  return features().bmi2;
+}
+
+//----------------------------------------------------------------
+bool CPUFeatures::hasAVX512()
+{
+  return features().avx512;
+}
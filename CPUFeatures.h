@@ -0,0 +1,61 @@
+/*
+ File: CPUFeatures.h
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CPUFEATURES_H_
+#define CPUFEATURES_H_
+
+namespace CPUFeatures
+{
+  /** \brief Returns true if the processor supports the SSSE3 and SSE4.1 instructions.
+   *
+   */
+  bool hasSSE41();
+
+  /** \brief Returns true if the processor supports the SSE4.2 instructions.
+   *
+   */
+  bool hasSSE42();
+
+  /** \brief Returns true if the processor supports the carry-less multiplication instruction (PCLMULQDQ).
+   *
+   */
+  bool hasPCLMUL();
+
+  /** \brief Returns true if the processor supports the SHA-1 and SHA-256 instructions (SHA-NI).
+   *
+   */
+  bool hasSHA();
+
+  /** \brief Returns true if the processor and the operating system support the AVX2 instructions.
+   *
+   */
+  bool hasAVX2();
+
+  /** \brief Returns true if the processor supports the BMI2 instructions.
+   *
+   */
+  bool hasBMI2();
+
+  /** \brief Returns true if the processor and the operating system support the AVX-512 Foundation instructions.
+   *
+   */
+  bool hasAVX512();
+}
+
+#endif // CPUFEATURES_H_
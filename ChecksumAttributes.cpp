@@ -0,0 +1,177 @@
+/*
+ File: ChecksumAttributes.cpp
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Project
+#include <ChecksumAttributes.h>
+#include <Hash.h>
+
+// Qt
+#include <QByteArray>
+#include <QDir>
+#include <QFile>
+
+// C++
+#include <array>
+
+#ifdef Q_OS_WIN
+#include <windows.h>
+#else
+#include <sys/types.h>
+#include <sys/xattr.h>
+#endif
+
+/** Maximum size of the attribute values, the mtime and the longest digest with spaces. */
+static const int MAX_VALUE_SIZE = 256;
+
+/** \brief Returns the digest in lowercase hexadecimal without the spaces and line breaks of the
+ * hash values.
+ * \param[in] value hash value.
+ *
+ */
+static QString compact(const QString &value)
+{
+  return QString(value).remove(' ').remove('\n').toLower();
+}
+
+/** \brief Returns the compact digest in the format of the values of the hashes of the given
+ * algorithm, or unchanged if it doesn't have the length of their digests.
+ * \param[in] algorithm algorithm descriptor.
+ * \param[in] digest compact digest.
+ *
+ */
+static QString expand(const Algorithms::Descriptor &algorithm, const QString &digest)
+{
+  // the values are zero padded, the value of a new hash has the separators of every digest.
+  static const auto LAYOUTS = []()
+  {
+    std::array<QString, Algorithms::COUNT> layouts;
+    for(const auto &descriptor: Algorithms::REGISTRY)
+    {
+      layouts[Algorithms::index(descriptor.id)] = descriptor.create()->value();
+    }
+
+    return layouts;
+  }();
+
+  auto value = LAYOUTS[Algorithms::index(algorithm.id)];
+  int position = 0;
+
+  for(auto &character: value)
+  {
+    if(character == ' ' || character == '\n') continue;
+    if(position == digest.length()) return digest;
+
+    character = digest.at(position++);
+  }
+
+  return position == digest.length() ? value : digest;
+}
+
+//----------------------------------------------------------------
+QString ChecksumAttributes::name(const QString &algorithm)
+{
+  return QString("user.checksum.") + QString(algorithm).toLower().remove('-').replace('/', '_');
+}
+
+//----------------------------------------------------------------
+bool ChecksumAttributes::read(const QString &filename, const Algorithms::Descriptor &algorithm, const qint64 mtime, QString &digest)
+{
+  char buffer[MAX_VALUE_SIZE];
+  long long length = -1;
+
+#ifdef Q_OS_WIN
+  const auto stream = (QDir::toNativeSeparators(filename) + ':' + name(algorithm.name)).toStdWString();
+  auto handle = ::CreateFileW(stream.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, 0, nullptr);
+  if(handle == INVALID_HANDLE_VALUE) return false;
+
+  DWORD bytesRead = 0;
+  if(::ReadFile(handle, buffer, sizeof(buffer), &bytesRead, nullptr)) length = bytesRead;
+  ::CloseHandle(handle);
+#else
+  const auto path      = QFile::encodeName(filename);
+  const auto attribute = name(algorithm.name).toLatin1();
+#ifdef Q_OS_MACOS
+  length = ::getxattr(path.constData(), attribute.constData(), buffer, sizeof(buffer), 0, 0);
+#else
+  length = ::getxattr(path.constData(), attribute.constData(), buffer, sizeof(buffer));
+#endif
+#endif
+
+  if(length <= 0) return false;
+
+  // the value is "<mtime> <digest>".
+  const auto value = QString::fromUtf8(buffer, length);
+  const auto separator = value.indexOf(' ');
+  if(separator <= 0) return false;
+
+  bool ok = false;
+  const auto storedTime = value.left(separator).toLongLong(&ok);
+  if(!ok || storedTime != mtime) return false;
+
+  // the digests stored by older versions have the separators of the hash values.
+  const auto stored = compact(value.mid(separator + 1));
+  if(stored.length() != algorithm.digestLength) return false;
+
+  digest = expand(algorithm, stored);
+  return true;
+}
+
+//----------------------------------------------------------------
+bool ChecksumAttributes::write(const QString &filename, const Algorithms::Descriptor &algorithm, const qint64 mtime, const QString &digest)
+{
+  const auto value = (QString::number(mtime) + ' ' + compact(digest)).toUtf8();
+  if(value.size() > MAX_VALUE_SIZE) return false;
+
+#ifdef Q_OS_WIN
+  // writing a stream updates the modification time of the file, it's restored after it.
+  const auto path = QDir::toNativeSeparators(filename).toStdWString();
+  auto file = ::CreateFileW(path.c_str(), FILE_READ_ATTRIBUTES | FILE_WRITE_ATTRIBUTES, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS, nullptr);
+  if(file == INVALID_HANDLE_VALUE) return false;
+
+  FILETIME writeTime;
+  bool success = ::GetFileTime(file, nullptr, nullptr, &writeTime);
+
+  if(success)
+  {
+    const auto stream = (QDir::toNativeSeparators(filename) + ':' + name(algorithm.name)).toStdWString();
+    auto handle = ::CreateFileW(stream.c_str(), GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, 0, nullptr);
+    success = (handle != INVALID_HANDLE_VALUE);
+
+    if(success)
+    {
+      DWORD bytesWritten = 0;
+      success = ::WriteFile(handle, value.constData(), value.size(), &bytesWritten, nullptr) && bytesWritten == static_cast<DWORD>(value.size());
+      ::CloseHandle(handle);
+    }
+
+    success &= (::SetFileTime(file, nullptr, nullptr, &writeTime) != 0);
+  }
+
+  ::CloseHandle(file);
+  return success;
+#else
+  const auto path      = QFile::encodeName(filename);
+  const auto attribute = name(algorithm.name).toLatin1();
+#ifdef Q_OS_MACOS
+  return ::setxattr(path.constData(), attribute.constData(), value.constData(), value.size(), 0, 0) == 0;
+#else
+  return ::setxattr(path.constData(), attribute.constData(), value.constData(), value.size(), 0) == 0;
+#endif
+#endif
+}
@@ -0,0 +1,67 @@
+/*
+ File: ChecksumAttributes.h
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CHECKSUMATTRIBUTES_H_
+#define CHECKSUMATTRIBUTES_H_
+
+// Project
+#include <hash/Algorithms.h>
+
+// Qt
+#include <QString>
+
+/** \namespace ChecksumAttributes
+ * \brief Digests stored in the extended attributes of the files, user.checksum.<algorithm>, with
+ *        the modification time of the file when they were computed, "<mtime> <digest>" with the
+ *        digest in lowercase hexadecimal like sha256sum prints it. The attributes move with the
+ *        files when they are renamed or copied with their attributes (rsync -X). On Windows they
+ *        are stored in alternate data streams of the same name.
+ *
+ */
+namespace ChecksumAttributes
+{
+  /** \brief Returns the name of the attribute of the given algorithm, user.checksum.sha256 for SHA-256.
+   * \param[in] algorithm hash name.
+   *
+   */
+  QString name(const QString &algorithm);
+
+  /** \brief Returns true and the stored digest of the given algorithm if the file has it and it
+   * was computed at the given modification time. The digest is returned in the format of the
+   * values of the hashes of the algorithm.
+   * \param[in] filename file name.
+   * \param[in] algorithm algorithm descriptor.
+   * \param[in] mtime current modification time of the file in nanoseconds.
+   * \param[out] digest hash value.
+   *
+   */
+  bool read(const QString &filename, const Algorithms::Descriptor &algorithm, const qint64 mtime, QString &digest);
+
+  /** \brief Stores the digest of the given algorithm in the file attributes, without the spaces and
+   * line breaks of the hash values. Returns false on error.
+   * \param[in] filename file name.
+   * \param[in] algorithm algorithm descriptor.
+   * \param[in] mtime modification time of the file in nanoseconds when the digest was computed.
+   * \param[in] digest hash value.
+   *
+   */
+  bool write(const QString &filename, const Algorithms::Descriptor &algorithm, const qint64 mtime, const QString &digest);
+}
+
+#endif // CHECKSUMATTRIBUTES_H_
@@ -0,0 +1,465 @@
+/*
+ File: CommandLine.cpp
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Project
+#include <CommandLine.h>
+#include <ComputerThread.h>
+#include <hash/Algorithms.h>
+
+// Qt
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QFileInfo>
+#include <QRegularExpression>
+
+// C++
+#include <cstdio>
+
+#ifdef Q_OS_WIN
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+/** Size of the read buffer of each thread. */
+static const int BUFFER_SIZE = 4 * 1024 * 1024;
+
+/** \struct Expected
+ * \brief Hash read from a SUMS file.
+ *
+ */
+struct Expected
+{
+  QString                       filename;  /** name of the hashed file.       */
+  const Algorithms::Descriptor *algorithm; /** algorithm of the hash.         */
+  QString                       digest;    /** hash value in lowercase.       */
+};
+
+/** \brief Returns the text without the characters that change between the names of the
+ * algorithms in the arguments, the registry and the SUMS files: SHA-512/256, sha512_256.
+ * \param[in] text algorithm name.
+ *
+ */
+static QString compact(const QString &text)
+{
+  return QString(text).toUpper().remove('-').remove('_').remove('/');
+}
+
+/** \brief Returns the descriptor of the algorithm with the given name, in any case and
+ * with or without separators, or nullptr if there is none.
+ * \param[in] name algorithm name.
+ *
+ */
+static const Algorithms::Descriptor *findAlgorithm(const QString &name)
+{
+  for(const auto &algorithm: Algorithms::REGISTRY)
+  {
+    if(compact(algorithm.name) == compact(name)) return &algorithm;
+  }
+
+  return nullptr;
+}
+
+/** \brief Returns the digest of the hash in lowercase without spaces or line breaks.
+ * \param[in] hash finalized hash object.
+ *
+ */
+static QString digest(const Hash *hash)
+{
+  return hash->value().remove(' ').remove('\n').toLower();
+}
+
+/** \brief Writes the text to the standard output.
+ * \param[in] text text to print.
+ *
+ */
+static void print(const QString &text)
+{
+  std::fputs(text.toLocal8Bit().constData(), stdout);
+}
+
+/** \brief Writes the text to the standard error.
+ * \param[in] text text to print.
+ *
+ */
+static void printError(const QString &text)
+{
+  std::fputs(text.toLocal8Bit().constData(), stderr);
+}
+
+/** \brief Prints the hash in the format of sha256sum, or in the BSD tagged one if the files are
+ * hashed with several algorithms.
+ * \param[in] filename name of the hashed file.
+ * \param[in] hash computed hash.
+ * \param[in] tagged true to use the BSD tagged format.
+ *
+ */
+static void printHash(const QString &filename, const Hash *hash, const bool tagged)
+{
+  if(tagged)
+  {
+    print(QString("%1 (%2) = %3\n").arg(Algorithms::descriptor(hash->algorithm()).name).arg(filename).arg(digest(hash)));
+  }
+  else
+  {
+    print(QString("%1  %2\n").arg(digest(hash)).arg(filename));
+  }
+}
+
+/** \brief Computes the hashes with the computer thread and returns the computed ones.
+ * \param[in] computations maps files to hashes to be computed.
+ * \param[in] threads number of threads or -1 for all the cores.
+ * \param[in] attributes true to read and store the digests in the extended attributes of the files.
+ * \param[out] errors errors reading the files or empty if none.
+ *
+ */
+static QMap<QString, HashList> compute(const QMap<QString, HashList> &computations, const int threads, const bool attributes, QString &errors)
+{
+  if(computations.isEmpty()) return QMap<QString, HashList>();
+
+  ComputerThread thread{computations, threads, BUFFER_SIZE, false, attributes};
+  QObject::connect(&thread, &QThread::finished, QCoreApplication::instance(), &QCoreApplication::quit, Qt::QueuedConnection);
+
+  // the finished signal is queued after the last progress report, that stores the results.
+  thread.start();
+  QCoreApplication::exec();
+
+  errors = thread.getErrors();
+  return thread.getResults();
+}
+
+/** \brief Computes the hashes of the files and of the files of the directories and their
+ * subdirectories, printing each one as soon as it's computed. The directories are read while
+ * the files already found are being hashed, and the hashes aren't kept in memory.
+ * \param[in] computations maps files to hashes to be computed.
+ * \param[in] directories directories to hash recursively.
+ * \param[in] algorithms hash algorithms of the files of the directories.
+ * \param[in] threads number of threads or -1 for all the cores.
+ * \param[in] attributes true to read and store the digests in the extended attributes of the files.
+ * \param[out] errors errors reading the files or empty if none.
+ *
+ */
+static void computeRecursive(const QMap<QString, HashList> &computations, const QStringList &directories,
+                             const QList<const Algorithms::Descriptor *> &algorithms, const int threads,
+                             const bool attributes, QString &errors)
+{
+  auto factory = [&algorithms](const QString &, HashList &)
+  {
+    HashList hashes;
+    for(auto algorithm: algorithms)
+    {
+      hashes << algorithm->create();
+    }
+
+    return hashes;
+  };
+
+  const auto tagged = algorithms.size() > 1;
+
+  ComputerThread thread{computations, threads, BUFFER_SIZE, false, attributes};
+  thread.setDirectories(directories, factory);
+  thread.setKeepResults(false);
+
+  // the hashes are reported by the progress updates, in the main thread.
+  QObject::connect(&thread, &ComputerThread::hashComputed, [tagged](const QString &filename, const Hash *hash) { printHash(filename, hash, tagged); });
+  QObject::connect(&thread, &QThread::finished, QCoreApplication::instance(), &QCoreApplication::quit, Qt::QueuedConnection);
+
+  thread.start();
+  QCoreApplication::exec();
+
+  errors = thread.getErrors();
+}
+
+/** \brief Returns the computed hash of the given algorithm or nullptr if it couldn't be computed.
+ * \param[in] hashes computed hashes of a file.
+ * \param[in] algorithm hash algorithm.
+ *
+ */
+static const Hash *find(const HashList &hashes, const Algorithms::Descriptor &algorithm)
+{
+  for(const auto &hash: hashes)
+  {
+    if(hash->algorithm() == algorithm.id) return hash.get();
+  }
+
+  return nullptr;
+}
+
+/** \brief Reads the hashes of the given SUMS or SFV file. Returns false on error.
+ * \param[in] filename SUMS file name.
+ * \param[in] algorithm algorithm given in the arguments or nullptr to guess it from the file name.
+ * \param[out] hashes read hashes.
+ *
+ */
+static bool readSums(const QString &filename, const Algorithms::Descriptor *algorithm, QList<Expected> &hashes)
+{
+  QFile file{filename};
+  if(!file.open(QIODevice::ReadOnly | QIODevice::Text))
+  {
+    printError(QObject::tr("%1: %2\n").arg(filename).arg(file.errorString()));
+    return false;
+  }
+
+  // GNU 'digest  name' or 'digest *name', BSD 'ALGORITHM (name) = digest' and SFV 'name checksum' lines.
+  static const QRegularExpression GNU_LINE{"^\\\\?([0-9a-fA-F]+) [ *](.+)$"};
+  static const QRegularExpression BSD_LINE{"^\\\\?([^ ]+) \\((.+)\\) = ([0-9a-fA-F]+)$"};
+  const bool isSFV = QFileInfo{filename}.suffix().compare("sfv", Qt::CaseInsensitive) == 0;
+  const auto sumsName = QFileInfo{filename}.fileName();
+  int errors = 0;
+
+  while(!file.atEnd())
+  {
+    const auto line = QString::fromUtf8(file.readLine()).remove('\r').remove('\n');
+    if(line.trimmed().isEmpty() || (isSFV && line.startsWith(';'))) continue;
+
+    Expected hash{QString(), algorithm, QString()};
+
+    QRegularExpressionMatch match;
+    if(isSFV)
+    {
+      const auto text      = line.trimmed();
+      const auto separator = text.lastIndexOf(' ');
+      if(separator != -1)
+      {
+        hash.filename = text.left(separator).trimmed();
+        hash.digest   = text.mid(separator + 1);
+        if(!hash.algorithm) hash.algorithm = &Algorithms::descriptor(Algorithms::Id::CRC32);
+      }
+    }
+    else if((match = BSD_LINE.match(line)).hasMatch())
+    {
+      hash.filename = match.captured(2);
+      hash.digest   = match.captured(3);
+      if(!hash.algorithm) hash.algorithm = findAlgorithm(match.captured(1));
+    }
+    else if((match = GNU_LINE.match(line)).hasMatch())
+    {
+      hash.filename = match.captured(2);
+      hash.digest   = match.captured(1);
+      if(!hash.algorithm) hash.algorithm = Algorithms::fromSumsFile(sumsName, hash.digest.length());
+    }
+
+    if(hash.filename.isEmpty() || !hash.algorithm || hash.digest.length() != hash.algorithm->digestLength)
+    {
+      ++errors;
+      continue;
+    }
+
+    hash.digest = hash.digest.toLower();
+    hashes << hash;
+  }
+
+  if(errors != 0)
+  {
+    printError(QObject::tr("%1: %2 lines are improperly formatted\n").arg(filename).arg(errors));
+  }
+
+  return true;
+}
+
+//----------------------------------------------------------------
+bool CommandLine::isRequested(int argc, char *argv[])
+{
+  for(int i = 1; i < argc; ++i)
+  {
+    if(qstrcmp(argv[i], "--cli") == 0) return true;
+  }
+
+  return false;
+}
+
+//----------------------------------------------------------------
+int CommandLine::run(int argc, char *argv[])
+{
+  QCoreApplication app(argc, argv);
+  QCoreApplication::setApplicationName("SimpleHasher");
+
+  QCommandLineParser parser;
+  parser.setApplicationDescription(QObject::tr("Computes the hashes of the files or checks the hashes of SUMS files."));
+  parser.addHelpOption();
+
+  const QCommandLineOption cliOption{"cli", QObject::tr("Run without the graphical interface.")};
+  const QCommandLineOption algorithmOption{{"a", "algorithm"}, QObject::tr("Hash algorithm, can be repeated. SHA-256 by default, or guessed from the SUMS file when checking."), QObject::tr("name")};
+  const QCommandLineOption threadsOption{{"t", "threads"}, QObject::tr("Number of simultaneous threads, all the cores by default."), QObject::tr("number")};
+  const QCommandLineOption checkOption{{"c", "check"}, QObject::tr("Read the hashes from the SUMS files and check them.")};
+  const QCommandLineOption attributesOption{{"x", "attributes"}, QObject::tr("Read and store the hashes in the extended attributes of the files.")};
+  const QCommandLineOption recursiveOption{{"r", "recursive"}, QObject::tr("Hash the files of the directories and their subdirectories, printing the hashes as they are computed.")};
+  const QCommandLineOption listOption{"list", QObject::tr("List the hash algorithms.")};
+
+  parser.addOptions({cliOption, algorithmOption, threadsOption, checkOption, attributesOption, recursiveOption, listOption});
+  parser.addPositionalArgument("files", QObject::tr("Files to hash, '-' for the standard input, or SUMS files to check."), "[files...]");
+  parser.process(app);
+
+  if(parser.isSet(listOption))
+  {
+    for(const auto &algorithm: Algorithms::REGISTRY)
+    {
+      print(QString("%1\t%2\n").arg(algorithm.name).arg(algorithm.description));
+    }
+    return 0;
+  }
+
+  QList<const Algorithms::Descriptor *> algorithms;
+  for(const auto &name: parser.values(algorithmOption))
+  {
+    for(const auto &part: name.split(',', Qt::SkipEmptyParts))
+    {
+      const auto algorithm = findAlgorithm(part.trimmed());
+      if(!algorithm)
+      {
+        printError(QObject::tr("Unknown hash algorithm '%1', use --list to see the available ones.\n").arg(part));
+        return 1;
+      }
+
+      if(!algorithms.contains(algorithm)) algorithms << algorithm;
+    }
+  }
+
+  int threads = -1;
+  if(parser.isSet(threadsOption))
+  {
+    bool ok = false;
+    threads = parser.value(threadsOption).toInt(&ok);
+    if(!ok || threads < 1)
+    {
+      printError(QObject::tr("Invalid number of threads '%1'.\n").arg(parser.value(threadsOption)));
+      return 1;
+    }
+  }
+
+  const auto files      = parser.positionalArguments();
+  const auto attributes = parser.isSet(attributesOption);
+  const auto recursive  = parser.isSet(recursiveOption);
+  int result = 0;
+
+  if(files.isEmpty())
+  {
+    printError(QObject::tr("No files given, use --help to see the usage.\n"));
+    return 1;
+  }
+
+  if(!parser.isSet(checkOption))
+  {
+    if(algorithms.isEmpty()) algorithms << &Algorithms::descriptor(Algorithms::Id::SHA256);
+
+#ifdef Q_OS_WIN
+    // the standard input is opened in text mode and would translate the line breaks.
+    if(files.contains(HashChecker::STANDARD_INPUT)) _setmode(_fileno(stdin), _O_BINARY);
+#endif
+
+    QMap<QString, HashList> computations;
+    QStringList directories;
+    for(const auto &file: files)
+    {
+      if(QFileInfo{file}.isDir())
+      {
+        if(recursive)
+        {
+          directories << file;
+        }
+        else
+        {
+          printError(QObject::tr("%1: Is a directory\n").arg(file));
+          result = 1;
+        }
+        continue;
+      }
+
+      for(auto algorithm: algorithms)
+      {
+        computations[file] << algorithm->create();
+      }
+    }
+
+    QString errors;
+    if(recursive)
+    {
+      computeRecursive(computations, directories, algorithms, threads, attributes, errors);
+    }
+    else
+    {
+      const auto results = compute(computations, threads, attributes, errors);
+
+      // the format of sha256sum for one algorithm and the BSD tagged one for several.
+      for(const auto &file: files)
+      {
+        for(auto algorithm: algorithms)
+        {
+          const auto hash = find(results.value(file), *algorithm);
+          if(hash) printHash(file, hash, algorithms.size() > 1);
+        }
+      }
+    }
+
+    printError(errors);
+    if(!errors.isEmpty()) result = 1;
+
+    return result;
+  }
+
+  if(algorithms.size() > 1)
+  {
+    printError(QObject::tr("Only one hash algorithm can be given when checking.\n"));
+    return 1;
+  }
+
+  QList<Expected> expected;
+  for(const auto &file: files)
+  {
+    if(!readSums(file, algorithms.isEmpty() ? nullptr : algorithms.first(), expected)) result = 1;
+  }
+
+  QMap<QString, HashList> computations;
+  for(const auto &hash: expected)
+  {
+    if(QFileInfo{hash.filename}.isFile() && !find(computations.value(hash.filename), *hash.algorithm))
+    {
+      computations[hash.filename] << hash.algorithm->create();
+    }
+  }
+
+  QString errors;
+  const auto results = compute(computations, threads, attributes, errors);
+  printError(errors);
+
+  int failed = 0, unread = 0;
+  for(const auto &hash: expected)
+  {
+    const auto computed = find(results.value(hash.filename), *hash.algorithm);
+
+    if(!computed)
+    {
+      print(QObject::tr("%1: FAILED open or read\n").arg(hash.filename));
+      ++unread;
+    }
+    else if(digest(computed) != hash.digest)
+    {
+      print(QObject::tr("%1: FAILED\n").arg(hash.filename));
+      ++failed;
+    }
+    else
+    {
+      print(QObject::tr("%1: OK\n").arg(hash.filename));
+    }
+  }
+
+  if(unread != 0) printError(QObject::tr("WARNING: %1 listed files could not be read\n").arg(unread));
+  if(failed != 0) printError(QObject::tr("WARNING: %1 computed checksums did NOT match\n").arg(failed));
+
+  return (result != 0 || unread != 0 || failed != 0) ? 1 : 0;
+}
@@ -0,0 +1,47 @@
+/*
+ File: CommandLine.h
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef COMMANDLINE_H_
+#define COMMANDLINE_H_
+
+/** \namespace CommandLine
+ * \brief Headless mode of the application. Computes the hashes with the same engine as the
+ *        main window and prints them in the format of sha256sum and similar tools, or checks
+ *        the hashes of SUMS files like 'sha256sum -c'. Only uses the Qt core module.
+ *
+ */
+namespace CommandLine
+{
+  /** \brief Returns true if the headless mode is requested in the given arguments.
+   * \param[in] argc number of arguments.
+   * \param[in] argv arguments.
+   *
+   */
+  bool isRequested(int argc, char *argv[]);
+
+  /** \brief Runs the headless mode and returns the exit code of the application, 0 on success
+   * and 1 on error or if the checked hashes don't match.
+   * \param[in] argc number of arguments.
+   * \param[in] argv arguments.
+   *
+   */
+  int run(int argc, char *argv[]);
+}
+
+#endif // COMMANDLINE_H_
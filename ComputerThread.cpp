@@ -19,36 +19,301 @@
 
 // Project
 #include <ComputerThread.h>
+#include <ChecksumAttributes.h>
+#include <DirectoryWalker.h>
+#include <hash/BLAKE3.h>
+#include <hash/KangarooTwelve.h>
+#include <hash/MerkleTree.h>
+#include <hash/Keccak.h>
+#include <hash/KeccakMultiBuffer.h>
+#include <hash/MD5.h>
+#include <hash/MD5MultiBuffer.h>
+#include <hash/SHA1.h>
+#include <hash/SHA1MultiBuffer.h>
+#include <hash/SHA256.h>
+#include <hash/SHA256MultiBuffer.h>
 
 // Qt
-#include <QMessageBox>
-#include <QIcon>
 #include <QThreadPool>
-#include <QApplication>
+#include <QFileInfo>
+
+// C++
+#include <algorithm>
+#include <cstdio>
+#include <typeinfo>
+
+#ifdef Q_OS_UNIX
+#include <sys/mman.h>
+#endif
+
+/** Maximum size of the files hashed with the multi-buffer engines, they are read completely in memory. */
+static const qint64 MULTI_BUFFER_FILE_SIZE = 1024 * 1024;
+
+/** Number of files of a multi-buffer group, a multiple of the lanes of every engine. */
+static const int MULTI_BUFFER_GROUP_SIZE = 16;
+
+/** Time in milliseconds between the checks of the abort flag of the producers waiting for the queue. */
+static const int ABORT_CHECK_INTERVAL = 50;
+
+const QString HashChecker::STANDARD_INPUT = QString("-");
+
+//----------------------------------------------------------------
+bool HashChecker::run(QByteArray &buffer, const bool useMemoryMap, const std::atomic<bool> &abort)
+{
+  QFile file{m_filename};
+
+  const auto opened = isStandardInput() ? file.open(stdin, QIODevice::ReadOnly | QIODevice::Unbuffered) : file.open(QIODevice::ReadOnly);
+  if(!opened)
+  {
+    m_error = file.errorString();
+    return false;
+  }
+
+  for(auto hash: m_hashes)
+  {
+    hash->reset();
+  }
+
+  // pipes and special files can't be mapped, neither can empty files.
+  const unsigned long long fileSize = file.size();
+  m_size = fileSize;
+  uchar *mapped = nullptr;
+  if(useMemoryMap && !file.isSequential() && !isStandardInput() && fileSize > 0)
+  {
+    mapped = file.map(0, fileSize);
+  }
+
+  bool success = true;
+  if(mapped)
+  {
+#ifdef Q_OS_UNIX
+    // the mapping starts at offset 0 so it's page aligned.
+    ::madvise(mapped, fileSize, MADV_SEQUENTIAL);
+#endif
+
+    hashMapped(mapped, fileSize, buffer.size(), abort);
+    file.unmap(mapped);
+  }
+  else
+  {
+    success = hashStream(file, buffer, abort);
+  }
+
+  file.close();
+
+  if(!success || abort) return false;
+
+  for(auto hash: m_hashes)
+  {
+    hash->finalize();
+  }
+
+  return true;
+}
 
 //----------------------------------------------------------------
-ComputerThread::ComputerThread(QMap<QString, HashList> computations, const int threadsNum, QObject *parent)
+bool HashChecker::hashStream(QFile &file, QByteArray &buffer, const std::atomic<bool> &abort)
+{
+  unsigned long long message_length = 0;
+  const unsigned long long fileSize = file.size();
+
+  // the size of pipes, sockets and character devices is unknown, they are read until the end.
+  const bool sequential = file.isSequential();
+  bool finished = false;
+
+  while((sequential ? !finished : fileSize != message_length) && !abort)
+  {
+    // pipes return a few KiB per read, the buffer is filled to update the hashes with large blocks.
+    qint64 bytesRead = 0;
+    do
+    {
+      const auto length = file.read(buffer.data() + bytesRead, buffer.size() - bytesRead);
+      if(length < 0 || (length == 0 && !sequential))
+      {
+        m_error = file.errorString();
+        return false;
+      }
+
+      finished   = (length == 0);
+      bytesRead += length;
+    }
+    while(sequential && !finished && bytesRead < buffer.size());
+
+    if(bytesRead == 0) continue;
+
+    message_length += bytesRead;
+
+    // the whole buffer is given to each hash in a single call.
+    const auto data = reinterpret_cast<const unsigned char *>(buffer.constData());
+    for(auto hash: m_hashes)
+    {
+      hash->update(data, bytesRead);
+    }
+
+    m_processed.store(message_length, std::memory_order_relaxed);
+  }
+
+  return true;
+}
+
+//----------------------------------------------------------------
+void HashChecker::hashMapped(const unsigned char *data, const unsigned long long size, const unsigned long long sliceSize, const std::atomic<bool> &abort)
+{
+  unsigned long long message_length = 0;
+
+  // the hashes read the mapping directly, the slices only pace the progress and abort checks.
+  while(size != message_length && !abort)
+  {
+    const auto length = std::min(sliceSize, size - message_length);
+    for(auto hash: m_hashes)
+    {
+      hash->update(data + message_length, length);
+    }
+
+    message_length += length;
+    m_processed.store(message_length, std::memory_order_relaxed);
+  }
+}
+
+//----------------------------------------------------------------
+bool HashChecker::load(QByteArray &contents)
+{
+  QFile file{m_filename};
+
+  if(!file.open(QIODevice::ReadOnly))
+  {
+    m_error = file.errorString();
+    return false;
+  }
+
+  const auto fileSize = file.size();
+  m_size = fileSize;
+  contents = file.readAll();
+
+  if(contents.size() != fileSize)
+  {
+    m_error = file.errorString();
+    return false;
+  }
+
+  for(auto hash: m_hashes)
+  {
+    hash->reset();
+  }
+
+  return true;
+}
+
+//----------------------------------------------------------------
+void HashChecker::process(const QByteArray &contents, const QList<const Hash *> &computed)
+{
+  const auto data = reinterpret_cast<const unsigned char *>(contents.constData());
+
+  for(auto hash: m_hashes)
+  {
+    if(!computed.contains(hash.get()))
+    {
+      hash->update(data, contents.size());
+    }
+
+    hash->finalize();
+  }
+
+  m_processed = contents.size();
+}
+
+//----------------------------------------------------------------
+MD5 *HashChecker::md5Hash() const
+{
+  for(auto hash: m_hashes)
+  {
+    auto md5 = dynamic_cast<MD5 *>(hash.get());
+    if(md5) return md5;
+  }
+
+  return nullptr;
+}
+
+//----------------------------------------------------------------
+SHA1 *HashChecker::sha1Hash() const
+{
+  for(auto hash: m_hashes)
+  {
+    // SHA-224 and SHA-256 derive from SHA1, only the exact type goes to the SHA-1 engines.
+    if(typeid(*hash) == typeid(SHA1)) return static_cast<SHA1 *>(hash.get());
+  }
+
+  return nullptr;
+}
+
+//----------------------------------------------------------------
+SHA256 *HashChecker::sha256Hash() const
+{
+  for(auto hash: m_hashes)
+  {
+    auto sha256 = dynamic_cast<SHA256 *>(hash.get());
+    if(sha256) return sha256;
+  }
+
+  return nullptr;
+}
+
+//----------------------------------------------------------------
+Keccak *HashChecker::keccakHash() const
+{
+  for(auto hash: m_hashes)
+  {
+    // the KangarooTwelve tree isn't a single sponge.
+    auto keccak = dynamic_cast<Keccak *>(hash.get());
+    if(keccak && !dynamic_cast<KangarooTwelve *>(keccak)) return keccak;
+  }
+
+  return nullptr;
+}
+
+//----------------------------------------------------------------
+ComputerThread::ComputerThread(QMap<QString, HashList> computations, const int threadsNum, const int bufferSize, const bool useMemoryMap, const bool useAttributes, QObject *parent)
 : QThread       {parent}
 , m_computations(computations)
 , m_abort       {false}
 , m_hashNumber  {0}
 , m_progress    {0}
-, m_maxThreads  {threadsNum}
-, m_threadsNum  {0}
+, m_lastProgress{-1}
+, m_maxThreads  {threadsNum == -1 ? QThreadPool::globalInstance()->maxThreadCount() : threadsNum}
+, m_bufferSize  {bufferSize}
+, m_useMemoryMap{useMemoryMap}
+, m_useAttributes{useAttributes}
+, m_keepResults {true}
+, m_queue       {static_cast<std::size_t>(2 * m_maxThreads)}
+, m_queueClosed {false}
+, m_queued      {0}
+, m_free        {2 * m_maxThreads}
 {
   qRegisterMetaType<const Hash *>("constHashPtr");
 
-  for(auto file: m_computations.keys())
-  {
-    m_hashNumber += m_computations[file].size();
-  }
+  // the timer lives in the main thread, like this object.
+  m_progressTimer.setInterval(50);
+  connect(&m_progressTimer, SIGNAL(timeout()), this, SLOT(onProgressTimer()));
+  connect(this, SIGNAL(started()), &m_progressTimer, SLOT(start()));
+  connect(this, SIGNAL(finished()), &m_progressTimer, SLOT(stop()));
+
+  // the worker threads are also busy with the subtrees and leaves of their own files.
+  m_subtreePool.setMaxThreadCount(std::max(1, m_maxThreads - 1));
 
-  if(m_maxThreads == -1)
+  for(const auto &hashes: m_computations)
   {
-    m_maxThreads = QThreadPool::globalInstance()->maxThreadCount();
+    m_hashNumber += hashes.size();
+    prepareHashes(hashes);
   }
 }
 
+//----------------------------------------------------------------
+void ComputerThread::setDirectories(const QStringList &directories, const HashesFactory &factory)
+{
+  m_directories = directories;
+  m_factory     = factory;
+}
+
 //----------------------------------------------------------------
 QMap<QString, HashList> ComputerThread::getResults() const
 {
@@ -59,38 +324,66 @@ QMap<QString, HashList> ComputerThread::getResults() const
 void ComputerThread::abort()
 {
   m_abort = true;
-  m_condition.wakeAll();
+
+  // wakes up the idle workers.
+  m_queued.release(m_maxThreads);
 }
 
 //----------------------------------------------------------------
-void ComputerThread::onHashComputed(const QString &filename, const Hash *hash)
+void ComputerThread::onHashComputed(const QString &filename, const HashSPtr hash)
 {
-  QMutexLocker lock(&m_progressMutex);
-
-  for(auto hashSPtr: m_computations[filename])
+  if(m_keepResults)
   {
-    if(hashSPtr.get() == hash)
-    {
-      m_results[filename] << hashSPtr;
-      break;
-    }
+    m_results[filename] << hash;
   }
 
-  emit hashComputed(filename, hash);
+  emit hashComputed(filename, hash.get());
 }
 
 //----------------------------------------------------------------
-void ComputerThread::onProgressSignaled()
+void ComputerThread::onProgressTimer()
 {
-  QMutexLocker lock(&m_progressMutex);
+  HashCheckerList running, finished;
+  long long progressValue = 0;
 
-  if(m_hashNumber > 0)
   {
-    auto progressValue = m_progress * 100;
+    QMutexLocker lock(&m_progressMutex);
 
-    std::for_each(m_threads.constBegin(), m_threads.constEnd(), [&progressValue](const std::shared_ptr<HashChecker> task) { if(task) progressValue += task->progress();});
+    running = m_running;
+    finished.swap(m_finished);
+    progressValue = m_progress * 100;
+  }
+
+  for(auto task: finished)
+  {
+    for(auto hash: task->hashes())
+    {
+      onHashComputed(task->filename(), hash);
+    }
+  }
+
+  for(auto task: running)
+  {
+    const auto value = task->progress();
+    progressValue += value * task->hashesNumber();
+
+    if(value != task->reportedProgress())
+    {
+      task->setReportedProgress(value);
+
+      for(auto hash: task->hashes())
+      {
+        emit hashUpdated(task->filename(), hash.get(), value);
+      }
+    }
+  }
 
-    emit progress(progressValue/m_hashNumber);
+  // the number of hashes grows while the folders are walked, the progress never goes back.
+  const long long hashNumber = m_hashNumber;
+  if(hashNumber > 0 && (progressValue / hashNumber) > m_lastProgress)
+  {
+    m_lastProgress = static_cast<int>(progressValue / hashNumber);
+    emit progress(m_lastProgress);
   }
 }
 
@@ -99,89 +392,345 @@ void ComputerThread::run()
 {
   m_fileErrors.clear();
 
-  for(int i = 0; i < m_computations.keys().size() && !m_abort; ++i)
+  // the workers live for the whole computation, the tasks are plain objects.
+  std::vector<std::unique_ptr<QThread>> workers;
+  for(int i = 0; i < m_maxThreads; ++i)
   {
-    auto filename = m_computations.keys().at(i);
+    workers.emplace_back(QThread::create([this]() { processTasks(); }));
+    workers.back()->start();
+  }
 
-    for(auto hash: m_computations[filename])
+  for(auto it = m_computations.constBegin(); it != m_computations.constEnd() && !m_abort; ++it)
+  {
+    schedule(it.key(), it.value(), -1);
+  }
+
+  // the files of the directories are hashed while the rest of them are being read.
+  if(!m_directories.isEmpty() && m_factory && !m_abort)
+  {
+    DirectoryWalker walker{[this](const QString &filename, const qint64 size)
     {
-      // wait if we have reached the maximum number of threads.
-      if(m_threadsNum == m_maxThreads)
+      HashList cached;
+      const auto hashes = m_factory(filename, cached);
+      prepareHashes(hashes);
+      m_hashNumber += hashes.size() + cached.size();
+
+      // the known digests are reported with the next progress update.
+      if(!cached.isEmpty())
       {
-        m_mutex.lock();
-        m_condition.wait(&m_mutex);
-        m_mutex.unlock();
+        reportFinished(std::make_shared<HashChecker>(filename, cached), true);
       }
 
-      if(m_abort) break;
-
-      auto file = new QFile{filename};
-
-      if(!file->open(QIODevice::ReadOnly) || !file->seek(0))
+      if(!hashes.isEmpty())
       {
-        m_fileErrors.append(tr("%1 error: %2\n").arg(filename).arg(file->errorString()));
-        delete file;
-        continue;
+        schedule(filename, hashes, size);
       }
+    }};
 
-      auto runnable = std::make_shared<HashChecker>(hash, file);
-      connect(runnable.get(), SIGNAL(hashComputed(const QString &, const Hash *)), this, SLOT(onHashComputed(const QString &, const Hash *)));
-      connect(runnable.get(), SIGNAL(hashUpdated(const QString &, const Hash *, const int)), this, SIGNAL(hashUpdated(const QString &, const Hash *, const int)));
-      connect(runnable.get(), SIGNAL(progressed()), this, SLOT(onProgressSignaled()));
-      connect(runnable.get(), SIGNAL(finished()), this, SLOT(onThreadFinished()));
+    walker.walk(m_directories, m_abort);
+  }
 
-      {
-        QMutexLocker lock(&m_progressMutex);
+  if(!m_group.isEmpty())
+  {
+    queueTasks(m_group);
+    m_group.clear();
+  }
 
-        ++m_threadsNum;
-        m_threads << runnable;
-      }
-      runnable->start();
+  // wakes up the idle workers, they find the queue empty and end.
+  m_queueClosed = true;
+  m_queued.release(m_maxThreads);
+
+  for(auto &worker: workers)
+  {
+    worker->wait();
+  }
+
+  // report the last results before the finished signal.
+  QMetaObject::invokeMethod(this, &ComputerThread::onProgressTimer, Qt::QueuedConnection);
+}
+
+//----------------------------------------------------------------
+void ComputerThread::processTasks()
+{
+  QByteArray buffer{m_bufferSize, 0};
+  HashCheckerList group;
+
+  while(true)
+  {
+    // one token for each queued group, and one for each worker when the queue is closed.
+    m_queued.acquire();
+
+    bool popped = false;
+    while(!m_abort && !(popped = m_queue.pop(group)) && !m_queueClosed)
+    {
+      // the token was released by a producer whose cell comes after the one of a push in progress.
+      QThread::yieldCurrentThread();
     }
+
+    // all the tasks have been pushed before closing the queue, it's empty.
+    if(!popped) break;
+
+    m_free.release();
+
+    {
+      QMutexLocker lock(&m_progressMutex);
+      m_running << group;
+    }
+
+    if(group.size() == 1)
+    {
+      const auto task    = group.first();
+      const auto success = task->run(buffer, m_useMemoryMap, m_abort);
+
+      reportFinished(task, success);
+    }
+    else
+    {
+      processGroup(group);
+    }
+
+    group.clear();
+  }
+}
+
+//----------------------------------------------------------------
+void ComputerThread::processGroup(const HashCheckerList &group)
+{
+  HashCheckerList loaded;
+  QList<QByteArray> contents;
+
+  for(auto task: group)
+  {
+    QByteArray fileContents;
+    if(m_abort || !task->load(fileContents))
+    {
+      reportFinished(task, false);
+      continue;
+    }
+
+    loaded << task;
+    contents << fileContents;
   }
 
-  while(!m_threads.isEmpty() && !m_abort)
+  QList<QList<const Hash *>> computed;
+  for(int i = 0; i < loaded.size(); ++i)
   {
-    m_mutex.lock();
-    m_condition.wait(&m_mutex);
-    m_mutex.unlock();
+    computed << QList<const Hash *>();
   }
 
-  if(m_abort)
+  // updates the hashes of each engine with the file contents, taking the data pointers
+  // once the list of contents is complete.
+  auto computeHashes = [&](auto getHash, auto update)
   {
-    QMutexLocker lock(&m_progressMutex);
+    using HashPtr = decltype(getHash(loaded.first()));
+    std::vector<HashPtr> hashes;
+    std::vector<const unsigned char *> data;
+    std::vector<unsigned long long> lengths;
+
+    for(int i = 0; i < loaded.size(); ++i)
+    {
+      const auto hash = getHash(loaded.at(i));
+      if(!hash) continue;
 
-    std::for_each(m_threads.begin(), m_threads.end(), [](std::shared_ptr<HashChecker> thread) { thread->abort(); });
+      hashes.push_back(hash);
+      data.push_back(reinterpret_cast<const unsigned char *>(contents.at(i).constData()));
+      lengths.push_back(contents.at(i).size());
+      computed[i] << hash;
+    }
+
+    if(!m_abort && !hashes.empty())
+    {
+      update(hashes.data(), data.data(), lengths.data(), static_cast<int>(hashes.size()));
+    }
+  };
+
+  if(!loaded.isEmpty() && MD5MultiBuffer::isAvailable())
+  {
+    computeHashes([](const HashCheckerSPtr task) { return task->md5Hash(); }, MD5MultiBuffer::update);
+  }
+
+  if(!loaded.isEmpty() && SHA1MultiBuffer::isAvailable())
+  {
+    computeHashes([](const HashCheckerSPtr task) { return task->sha1Hash(); }, SHA1MultiBuffer::update);
   }
 
-  QApplication::processEvents();
+  if(!loaded.isEmpty() && SHA256MultiBuffer::isAvailable())
+  {
+    computeHashes([](const HashCheckerSPtr task) { return task->sha256Hash(); }, SHA256MultiBuffer::update);
+  }
+
+  if(!loaded.isEmpty() && KeccakMultiBuffer::isAvailable())
+  {
+    computeHashes([](const HashCheckerSPtr task) { return task->keccakHash(); }, KeccakMultiBuffer::update);
+  }
+
+  for(int i = 0; i < loaded.size(); ++i)
+  {
+    if(!m_abort)
+    {
+      loaded.at(i)->process(contents.at(i), computed.at(i));
+    }
+
+    reportFinished(loaded.at(i), !m_abort);
+  }
+}
+
+//----------------------------------------------------------------
+void ComputerThread::queueTasks(const HashCheckerList &group)
+{
+  // the producers only wait for a free cell while all the workers are busy.
+  while(!m_free.tryAcquire(1, ABORT_CHECK_INTERVAL))
+  {
+    if(m_abort) return;
+  }
+
+  // the number of free cells is below the capacity of the queue, it can't fail.
+  m_queue.push(group);
+  m_queued.release();
 }
 
 //----------------------------------------------------------------
-void ComputerThread::onThreadFinished()
+void ComputerThread::reportFinished(const HashCheckerSPtr checker, const bool success)
 {
+  if(success && m_useAttributes) writeAttributes(checker);
+
   QMutexLocker lock(&m_progressMutex);
 
-  --m_threadsNum;
-  ++m_progress;
+  m_running.removeOne(checker);
+  m_progress += checker->hashesNumber();
+
+  if(success)
+  {
+    m_finished << checker;
+  }
+
+  if(!checker->error().isEmpty())
+  {
+    m_fileErrors.append(tr("%1 error: %2\n").arg(checker->filename()).arg(checker->error()));
+  }
+}
+
+//----------------------------------------------------------------
+void ComputerThread::prepareHashes(const HashList &hashes)
+{
+  if(m_maxThreads < 2) return;
+
+  for(auto hash: hashes)
+  {
+    auto blake3 = std::dynamic_pointer_cast<BLAKE3>(hash);
+    if(blake3)
+    {
+      blake3->setThreadPool(&m_subtreePool);
+    }
+
+    auto k12 = std::dynamic_pointer_cast<KangarooTwelve>(hash);
+    if(k12)
+    {
+      k12->setThreadPool(&m_subtreePool);
+    }
+
+    auto tree = std::dynamic_pointer_cast<MerkleTree>(hash);
+    if(tree)
+    {
+      tree->setThreadPool(&m_subtreePool);
+    }
+  }
+}
+
+//----------------------------------------------------------------
+void ComputerThread::schedule(const QString &filename, HashList hashes, const qint64 size)
+{
+  DigestCache::FileKey key;
+  const auto hasKey = m_useAttributes && filename != HashChecker::STANDARD_INPUT && DigestCache::fileKey(filename, key);
+
+  if(hasKey)
+  {
+    // the stored digests are reported with the next progress update.
+    const auto stored = readAttributes(filename, key, hashes);
+    if(!stored.isEmpty())
+    {
+      reportFinished(std::make_shared<HashChecker>(filename, stored), true);
+    }
+  }
+
+  if(hashes.isEmpty()) return;
 
-  auto senderThread = qobject_cast<HashChecker *>(sender());
-  if(senderThread)
+  const auto task = std::make_shared<HashChecker>(filename, hashes);
+  if(hasKey) task->setKey(key);
+
+  if((MD5MultiBuffer::isAvailable()    && task->md5Hash())    || (SHA1MultiBuffer::isAvailable()   && task->sha1Hash()) ||
+     (SHA256MultiBuffer::isAvailable() && task->sha256Hash()) || (KeccakMultiBuffer::isAvailable() && task->keccakHash()))
   {
-    disconnect(senderThread, SIGNAL(hashComputed(const QString &, const Hash *)), this, SLOT(onHashComputed(const QString &, const Hash *)));
-    disconnect(senderThread, SIGNAL(hashUpdated(const QString &, const Hash *, const int)), this, SIGNAL(hashUpdated(const QString &, const Hash *, const int)));
-    disconnect(senderThread, SIGNAL(progressed()), this, SLOT(onProgressSignaled()));
-    disconnect(senderThread, SIGNAL(finished()), this, SLOT(onThreadFinished()));
+    auto fileSize = size;
+    if(fileSize < 0 && !task->isStandardInput())
+    {
+      const QFileInfo info{filename};
+      if(info.isFile()) fileSize = info.size();
+    }
 
-    for(auto thread: m_threads)
+    if(fileSize >= 0 && fileSize <= MULTI_BUFFER_FILE_SIZE)
     {
-      if(thread.get() == senderThread)
+      // the full group is queued outside the lock, the queue can be full.
+      HashCheckerList group;
+
       {
-        m_threads.removeOne(thread);
-        break;
+        QMutexLocker lock(&m_groupMutex);
+        m_group << task;
+
+        if(m_group.size() == MULTI_BUFFER_GROUP_SIZE)
+        {
+          group.swap(m_group);
+        }
       }
+
+      if(!group.isEmpty())
+      {
+        queueTasks(group);
+      }
+      return;
     }
   }
 
-  m_condition.wakeAll();
+  queueTasks(HashCheckerList{task});
+}
+
+//----------------------------------------------------------------
+HashList ComputerThread::readAttributes(const QString &filename, const DigestCache::FileKey &key, HashList &hashes)
+{
+  HashList stored;
+
+  for(auto it = hashes.begin(); it != hashes.end();)
+  {
+    // the chunks of the Merkle trees aren't stored.
+    QString digest;
+    const auto &algorithm = Algorithms::descriptor((*it)->algorithm());
+    if(std::dynamic_pointer_cast<MerkleTree>(*it) || !ChecksumAttributes::read(filename, algorithm, key.mtime, digest))
+    {
+      ++it;
+      continue;
+    }
+
+    stored << std::make_shared<CachedHash>(algorithm, digest);
+    it = hashes.erase(it);
+  }
+
+  return stored;
+}
+
+//----------------------------------------------------------------
+void ComputerThread::writeAttributes(const HashCheckerSPtr checker)
+{
+  if(!checker->hasKey()) return;
+
+  // the digests of a file modified while being hashed aren't valid for its modification time.
+  DigestCache::FileKey key;
+  if(!DigestCache::fileKey(checker->filename(), key) || !(key == checker->key())) return;
+
+  // the files of read only file systems or without attributes support are hashed again next time.
+  for(auto hash: checker->hashes())
+  {
+    if(std::dynamic_pointer_cast<MerkleTree>(hash)) continue;
+
+    ChecksumAttributes::write(checker->filename(), Algorithms::descriptor(hash->algorithm()), key.mtime, hash->value());
+  }
 }
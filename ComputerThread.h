@@ -22,116 +22,201 @@
 
 // Project
 #include <Hash.h>
+#include <DigestCache.h>
+#include <JobQueue.h>
 
 // Qt
 #include <QThread>
 #include <QMap>
 #include <QMutex>
-#include <QWaitCondition>
+#include <QSemaphore>
+#include <QFile>
+#include <QTimer>
+#include <QThreadPool>
 
 // C++
 #include <atomic>
-#include <iostream>
+#include <functional>
+#include <memory>
+#include <vector>
 
 /** \class HashChecker
- * \brief Thread for computing an individual hash.
+ * \brief Task for computing all the hashes of an individual file. The file is read only once
+ *        and every chunk is fed to all the hashes.
  *
  */
+class MD5;
+class SHA1;
+class SHA256;
+class Keccak;
+
 class HashChecker
-: public QThread
 {
-    Q_OBJECT
   public:
     /** \brief HashChecker class constructor.
-     * \param[in] hash hash object to update.
-     * \param[in] file opened QFile object.
-     * \param[in] parent raw pointer of the object parent of this one.
+     * \param[in] filename name of the file to hash.
+     * \param[in] hashes list of hash objects to update.
      *
      */
-    HashChecker(std::shared_ptr<Hash> hash, QFile *file, QObject *parent = nullptr)
-    : QThread   {parent}
-    , m_hash    {hash}
-    , m_file    {file}
-    , m_progress{0}
-    , m_abort   {false}
+    HashChecker(const QString &filename, const HashList &hashes)
+    : m_filename {filename}
+    , m_hashes   {hashes}
+    , m_processed{0}
+    , m_size     {0}
+    , m_reported {0}
+    , m_hasKey   {false}
     {};
 
-    /** \brief HashChecker class virtual destructor.
+    /** \brief Returns the progress of the hash computation in [0,100].
      *
      */
-    ~HashChecker()
-    {
-      m_file->close();
-      delete m_file;
-    }
+    const int progress() const
+    { return m_size == 0 ? 0 : (m_processed * 100) / m_size; }
 
-    /** \brief Returns the progress of the hash computation in [0,100].
+    /** \brief Returns the last progress value reported to the user.
      *
      */
-    const int progress() const
-    { return m_progress; }
+    const int reportedProgress() const
+    { return m_reported; }
 
-    /** \brief Aborts the current hash computation.
+    /** \brief Sets the last progress value reported to the user.
+     * \param[in] value progress value in [0,100].
      *
      */
-    void abort()
-    { if(isRunning()) m_abort = true; }
+    void setReportedProgress(const int value)
+    { m_reported = value; }
 
-    /** \brief Returns true if aborted and false otherwise.
+    /** \brief Returns the number of hashes being computed.
      *
      */
-    const bool aborted() const
-    { return m_abort; }
+    const int hashesNumber() const
+    { return m_hashes.size(); }
 
-  signals:
-    void hashComputed(const QString &filename, const Hash *hash);
-    void hashUpdated(const QString &filename, const Hash *hash, const int value);
-    void progressed();
+    /** \brief Returns the hashes being computed.
+     *
+     */
+    const HashList &hashes() const
+    { return m_hashes; }
 
-  protected:
-    void run()
-    {
-      m_progress = 0;
-      m_file->seek(0);
-      unsigned long long message_length = 0;
-      const unsigned long long fileSize = m_file->size();
-      m_hash->reset();
-
-      while(fileSize != message_length && !m_abort)
-      {
-        int currentProgress = (message_length*100.)/fileSize;
-        if(currentProgress != m_progress)
-        {
-          m_progress = currentProgress;
-          emit progressed();
-          emit hashUpdated(m_file->fileName(), m_hash.get(), m_progress);
-        }
-
-        auto block = m_file->read(m_hash->blockSize());
-        message_length += block.length();
-        m_hash->update(block, message_length * m_hash->bitsPerUnit());
-
-        // last block needs to be processed
-        if((fileSize == message_length) && (block.size() == m_hash->blockSize()))
-        {
-          m_hash->update(QByteArray(), message_length * m_hash->bitsPerUnit());
-        }
-      }
-
-      m_file->close();
-      if(!m_abort) emit hashComputed(m_file->fileName(), m_hash.get());
-    }
+    /** \brief Returns the name of the file being hashed.
+     *
+     */
+    const QString &filename() const
+    { return m_filename; }
+
+    /** \brief Returns the error reading the file or empty if none.
+     *
+     */
+    const QString &error() const
+    { return m_error; }
+
+    /** \brief Returns true if the task hashes the standard input instead of a file.
+     *
+     */
+    bool isStandardInput() const
+    { return m_filename == STANDARD_INPUT; }
+
+    /** \brief Sets the key of the file when the task was created.
+     * \param[in] key file key.
+     *
+     */
+    void setKey(const DigestCache::FileKey &key)
+    { m_key = key; m_hasKey = true; }
+
+    /** \brief Returns true if the key of the file has been set.
+     *
+     */
+    bool hasKey() const
+    { return m_hasKey; }
+
+    /** \brief Returns the key of the file when the task was created, valid if it has been set.
+     *
+     */
+    const DigestCache::FileKey &key() const
+    { return m_key; }
+
+    static const QString STANDARD_INPUT; /** name of the standard input in the file lists, '-'. */
+
+    /** \brief Computes the hashes of the file. Returns true on success and false on error or abort.
+     * \param[in] buffer read buffer, reused between tasks.
+     * \param[in] useMemoryMap true to map the file in memory if it's a regular file and false to read it.
+     * \param[in] abort abort flag of the computation.
+     *
+     */
+    bool run(QByteArray &buffer, const bool useMemoryMap, const std::atomic<bool> &abort);
+
+    /** \brief Reads the complete file and resets the hashes. Returns true on success and false on error.
+     * \param[out] contents file contents.
+     *
+     */
+    bool load(QByteArray &contents);
+
+    /** \brief Updates the hashes with the file contents and finalizes them.
+     * \param[in] contents file contents.
+     * \param[in] computed hashes already updated with the contents.
+     *
+     */
+    void process(const QByteArray &contents, const QList<const Hash *> &computed);
+
+    /** \brief Returns the MD5 hash of the task or nullptr if it's not computed.
+     *
+     */
+    MD5 *md5Hash() const;
+
+    /** \brief Returns the SHA-1 hash of the task or nullptr if it's not computed.
+     *
+     */
+    SHA1 *sha1Hash() const;
+
+    /** \brief Returns the SHA-256 hash of the task or nullptr if it's not computed.
+     *
+     */
+    SHA256 *sha256Hash() const;
+
+    /** \brief Returns the first SHA-3 family hash of the task or nullptr if none is computed.
+     *
+     */
+    Keccak *keccakHash() const;
 
   private:
-    std::shared_ptr<Hash> m_hash;     /** hash object to update.                 */
-    QFile                *m_file;     /** opened QFile object.                   */
-    int                   m_progress; /** computation progress value in [0,100]. */
-    bool                  m_abort;    /** true if aborted, false otherwise.      */
+    /** \brief Feeds the file contents to the hashes using the read buffer. Returns true on success and false on error.
+     * \param[in] file opened file.
+     * \param[in] buffer read buffer.
+     * \param[in] abort abort flag of the computation.
+     *
+     */
+    bool hashStream(QFile &file, QByteArray &buffer, const std::atomic<bool> &abort);
 
+    /** \brief Feeds the mapped file contents to the hashes in slices of the given size.
+     * \param[in] data mapped file contents.
+     * \param[in] size size of the mapped file.
+     * \param[in] sliceSize number of bytes to process between progress updates.
+     * \param[in] abort abort flag of the computation.
+     *
+     */
+    void hashMapped(const unsigned char *data, const unsigned long long size, const unsigned long long sliceSize, const std::atomic<bool> &abort);
+
+    const QString                   m_filename;  /** name of the file to hash.                              */
+    HashList                        m_hashes;    /** hash objects to update.                                */
+    std::atomic<unsigned long long> m_processed; /** number of bytes processed, written by the worker.      */
+    std::atomic<unsigned long long> m_size;      /** size of the file in bytes.                             */
+    int                             m_reported;  /** last progress value reported, used in the main thread. */
+    QString                         m_error;     /** error reading the file or empty if none.               */
+    DigestCache::FileKey            m_key;       /** key of the file when the task was created.             */
+    bool                            m_hasKey;    /** true if the key of the file has been set.              */
 };
 
+using HashCheckerSPtr = std::shared_ptr<HashChecker>;
+using HashCheckerList = QList<HashCheckerSPtr>;
+
 /** \class ComputerThread
- * \brief Class to compute the hashes in a separate thread.
+ * \brief Class to compute the hashes in a separate thread. The files are hashed by a fixed
+ *        pool of worker threads that take the tasks from a lock-free queue. Small files that
+ *        need a MD5, SHA-1, SHA-256 or SHA-3 are queued in groups to hash them with the
+ *        multi-buffer engines. The BLAKE3 subtrees, K12 leaves and Merkle tree chunks of
+ *        large files are hashed by the threads of a pool. The digests stored in the extended
+ *        attributes of unchanged files aren't computed again. The files of the directories
+ *        are queued as they are found, while the rest of the directories are being read.
  *
  */
 class ComputerThread
@@ -139,12 +224,20 @@ class ComputerThread
 {
     Q_OBJECT
   public:
+    /** Returns the hash objects to compute for a file found in the directories, and in the
+     * cached list the hashes of the file whose digests are already known. */
+    using HashesFactory = std::function<HashList(const QString &filename, HashList &cached)>;
+
     /** \brief ComputeThread class constructor.
      * \param[in] computations maps files to hashes to be computed.
      * \param[in] threadsNum number of simultaneous threads or -1 for system's maximum value.
+     * \param[in] bufferSize size in bytes of the read buffer of each thread.
+     * \param[in] useMemoryMap true to map the regular files in memory instead of reading them.
+     * \param[in] useAttributes true to read the digests stored in the extended attributes of the files
+     * instead of computing them, and to store the computed ones.
      *
      */
-    ComputerThread(QMap<QString, HashList> computations, const int threadsNum, QObject *parent = nullptr);
+    ComputerThread(QMap<QString, HashList> computations, const int threadsNum, const int bufferSize, const bool useMemoryMap, const bool useAttributes = false, QObject *parent = nullptr);
 
     /** \brief ComputeThread class virtual destructor.
      *
@@ -152,6 +245,23 @@ class ComputerThread
     virtual ~ComputerThread()
     {};
 
+    /** \brief Sets the directories whose files are hashed after the given ones. The directories
+     * are read while the files found are being hashed. Must be called before starting the thread.
+     * \param[in] directories root directories, their subdirectories are also read.
+     * \param[in] factory returns the hashes to compute for each file and the known ones. Called
+     * from the threads that read the directories.
+     *
+     */
+    void setDirectories(const QStringList &directories, const HashesFactory &factory);
+
+    /** \brief Sets if the computed hashes are kept to be returned by getResults(), true by default.
+     * The hashes are only reported with the hashComputed signal if they aren't kept.
+     * \param[in] value true to keep the computed hashes and false otherwise.
+     *
+     */
+    void setKeepResults(const bool value)
+    { m_keepResults = value; }
+
     /** \brief Returns the map of file hashes.
      *
      */
@@ -180,39 +290,104 @@ class ComputerThread
     void hashUpdated(const QString &filename, const Hash *hash, const int value);
 
   private slots:
-    /** \brief Computes progress and emits progress and hashComputed signals.
+    /** \brief Stores the computed hash and emits the hashComputed signal.
      * \param[in] filename filename of the computed hash.
-     * \param[in] hash hash object pointer.
+     * \param[in] hash hash object.
      */
-    void onHashComputed(const QString &filename, const Hash *hash);
+    void onHashComputed(const QString &filename, const HashSPtr hash);
 
-    /** \brief Updates the total progress of the computations and reports it.
+    /** \brief Reports the finished tasks and the progress of the running ones. Called periodically
+     * in the main thread and once more when the computation ends.
      *
      */
-    void onProgressSignaled();
-
-    /** \brief Removes the finished thread from the thread pool.
-     *
-     */
-    void onThreadFinished();
+    void onProgressTimer();
 
   protected:
     virtual void run();
 
   private:
-    QMap<QString, HashList> m_computations;  /** maps the files with the hashes to be computed.                 */
-    bool                    m_abort;         /** set to true to stop computing and return ASAP.                 */
-    int                     m_hashNumber;    /** total number of hashes to compute.                             */
-    std::atomic<int>        m_progress;      /** progress accumulator.                                          */
-    QMutex                  m_progressMutex; /** protects the progress variable.                                */
-    QMutex                  m_mutex;         /** mutex for the wait condition.                                  */
-    QWaitCondition          m_condition;     /** wait condition for the main thread.                            */
-    int                     m_maxThreads;    /** max number of threads in the system.                           */
-    std::atomic<int>        m_threadsNum;    /** number of threads currently running.                           */
-    QMap<QString, HashList> m_results;       /** computed hashes.                                               */
-    QString                 m_fileErrors;    /** hash errors or empty if none.        */
-
-    QList<std::shared_ptr<HashChecker>> m_threads; /** list of running threads. */
+    /** \brief Worker thread loop, takes tasks from the queue until there are no more or the
+     * computation is aborted.
+     *
+     */
+    void processTasks();
+
+    /** \brief Computes the hashes of a group of small files, their MD5, SHA-1, SHA-256 and SHA-3 hashes
+     * are computed at the same time in the lanes of the multi-buffer engines.
+     * \param[in] group task objects.
+     *
+     */
+    void processGroup(const HashCheckerList &group);
+
+    /** \brief Adds the group of tasks to the queue, waiting for space if it's full.
+     * \param[in] group task objects.
+     *
+     */
+    void queueTasks(const HashCheckerList &group);
+
+    /** \brief Moves the task from the running ones to the finished ones, to be reported by the progress timer.
+     * \param[in] checker task object.
+     * \param[in] success true if the hashes have been computed and false otherwise.
+     *
+     */
+    void reportFinished(const HashCheckerSPtr checker, const bool success);
+
+    /** \brief Sets the thread pool of the hashes that compute parts of the message in parallel.
+     * \param[in] hashes hash objects.
+     *
+     */
+    void prepareHashes(const HashList &hashes);
+
+    /** \brief Creates the task of the given file and queues it, alone or in a group of small files
+     * for the multi-buffer engines. The stored digests of the file are reported instead of computed.
+     * \param[in] filename file name.
+     * \param[in] hashes hash objects to compute.
+     * \param[in] size size of the file in bytes or -1 if unknown.
+     *
+     */
+    void schedule(const QString &filename, HashList hashes, const qint64 size);
+
+    /** \brief Removes the hashes stored in the extended attributes of the file from the given ones
+     * and returns them with their stored values.
+     * \param[in] filename file name.
+     * \param[in] key current key of the file.
+     * \param[inout] hashes hash objects to compute.
+     *
+     */
+    HashList readAttributes(const QString &filename, const DigestCache::FileKey &key, HashList &hashes);
+
+    /** \brief Stores the computed digests of the task in the extended attributes of its file, if
+     * the file hasn't changed since the computation started.
+     * \param[in] checker task object.
+     *
+     */
+    void writeAttributes(const HashCheckerSPtr checker);
+
+    QMap<QString, HashList>   m_computations;  /** maps the files with the hashes to be computed.                 */
+    QStringList               m_directories;   /** directories whose files are hashed.                            */
+    HashesFactory             m_factory;       /** returns the hashes of the files of the directories.            */
+    std::atomic<bool>         m_abort;         /** set to true to stop computing and return ASAP.                 */
+    std::atomic<long long>    m_hashNumber;    /** total number of hashes to compute, grows with the directories. */
+    long long                 m_progress;      /** number of hashes of the finished tasks.                        */
+    int                       m_lastProgress;  /** last total progress value reported.                            */
+    QMutex                    m_progressMutex; /** protects the task lists and the errors.                        */
+    QTimer                    m_progressTimer; /** timer to report the progress in the main thread.               */
+    int                       m_maxThreads;    /** number of worker threads.                                      */
+    int                       m_bufferSize;    /** size in bytes of the read buffer of each thread.               */
+    bool                      m_useMemoryMap;  /** true to map the regular files in memory instead of reading them.*/
+    bool                      m_useAttributes; /** true to read and store the digests in the extended attributes. */
+    bool                      m_keepResults;   /** true to keep the computed hashes.                              */
+    QMap<QString, HashList>   m_results;       /** computed hashes.                                               */
+    QString                   m_fileErrors;    /** hash errors or empty if none.                                  */
+    JobQueue<HashCheckerList> m_queue;         /** queue of groups of tasks for the worker threads.               */
+    std::atomic<bool>         m_queueClosed;   /** true when all the tasks have been queued.                      */
+    QSemaphore                m_queued;        /** groups in the queue, the idle workers wait on it.              */
+    QSemaphore                m_free;          /** free cells of the queue, the producers wait on it.             */
+    HashCheckerList           m_running;       /** list of running tasks.                                         */
+    HashCheckerList           m_finished;      /** tasks finished since the last progress report.                 */
+    HashCheckerList           m_group;         /** small files waiting to complete a multi-buffer group.          */
+    QMutex                    m_groupMutex;    /** protects the group, filled by the threads reading directories. */
+    QThreadPool               m_subtreePool;   /** threads for the BLAKE3 subtrees, K12 leaves and Merkle chunks. */
 };
 
 #endif // COMPUTERTHREAD_H_
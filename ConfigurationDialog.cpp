@@ -29,18 +29,29 @@
 const QString SEND_TO_DIRPATH = QString("%1/AppData/Roaming/Microsoft/Windows/SendTo");
 
 //----------------------------------------------------------------
-ConfigurationDialog::ConfigurationDialog(bool useSpaces, bool split, bool uppercase, int numberOfThreads, QWidget *parent)
+ConfigurationDialog::ConfigurationDialog(bool useSpaces, bool split, bool uppercase, int numberOfThreads, int bufferSize, bool memoryMap, bool attributes, bool merkle, int chunkSize, QWidget *parent)
 : QDialog     {parent}
 , m_useSpaces {useSpaces}
 , m_splitHash {split}
 , m_uppercase {uppercase}
 , m_numThreads{numberOfThreads}
+, m_bufferMiB {bufferSize}
+, m_useMap    {memoryMap}
+, m_useXattr  {attributes}
+, m_useTree   {merkle}
+, m_chunkMiB  {chunkSize}
 {
   setupUi(this);
 
   m_spacesCheckbox->setChecked(useSpaces);
   m_splitCheckbox->setChecked(split);
   m_uppercaseCheckbox->setChecked(uppercase);
+  m_bufferSize->setValue(bufferSize);
+  m_memoryMap->setChecked(memoryMap);
+  m_attributes->setChecked(attributes);
+  m_merkle->setChecked(merkle);
+  m_chunkSize->setValue(chunkSize);
+  onMerkleCheckboxStateChanged();
 
   updateSentToUI();
 
@@ -57,6 +68,7 @@ ConfigurationDialog::ConfigurationDialog(bool useSpaces, bool split, bool upperc
 
   connect(m_sentToButton, SIGNAL(pressed()), this, SLOT(onSendToButtonPressed()));
   connect(m_useMaxThreads, SIGNAL(stateChanged(int)), this, SLOT(onThreadsCheckboxStateChanged()));
+  connect(m_merkle, SIGNAL(stateChanged(int)), this, SLOT(onMerkleCheckboxStateChanged()));
 }
 
 //----------------------------------------------------------------
@@ -67,7 +79,12 @@ bool ConfigurationDialog::isModified() const
   return ((m_useSpaces  != m_spacesCheckbox->isChecked()) ||
           (m_splitHash  != m_splitCheckbox->isChecked())  ||
           (m_uppercase  != m_uppercaseCheckbox->isChecked()) ||
-          (m_numThreads != threadsValue));
+          (m_numThreads != threadsValue) ||
+          (m_bufferMiB  != m_bufferSize->value()) ||
+          (m_useMap     != m_memoryMap->isChecked()) ||
+          (m_useXattr   != m_attributes->isChecked()) ||
+          (m_useTree    != m_merkle->isChecked()) ||
+          (m_chunkMiB   != m_chunkSize->value()));
 }
 
 //----------------------------------------------------------------
@@ -91,6 +108,14 @@ void ConfigurationDialog::onThreadsCheckboxStateChanged()
   }
 }
 
+//----------------------------------------------------------------
+void ConfigurationDialog::onMerkleCheckboxStateChanged()
+{
+  const auto value = m_merkle->isChecked();
+  m_chunkLabel->setEnabled(value);
+  m_chunkSize->setEnabled(value);
+}
+
 //----------------------------------------------------------------
 bool ConfigurationDialog::isSendToPresent() const
 {
@@ -41,9 +41,14 @@ class ConfigurationDialog
      * \param[in] split true to check the 'split' checkbox and false otherwise.
      * \param[in] threadsNum number of threads value or -1 for maximum.
      * \param[in] uppercase true to check the 'uppercase' checkbox and false otherwise.
+     * \param[in] bufferSize size of the read buffer in MiB.
+     * \param[in] memoryMap true to check the 'memory mapped files' checkbox and false otherwise.
+     * \param[in] attributes true to check the 'extended attributes' checkbox and false otherwise.
+     * \param[in] merkle true to check the 'Merkle tree' checkbox and false otherwise.
+     * \param[in] chunkSize size of the chunks of the Merkle tree in MiB.
      *
      */
-    ConfigurationDialog(bool useSpaces, bool split, bool uppercase, int threadsNum, QWidget *parent = nullptr);
+    ConfigurationDialog(bool useSpaces, bool split, bool uppercase, int threadsNum, int bufferSize, bool memoryMap, bool attributes, bool merkle, int chunkSize, QWidget *parent = nullptr);
 
     /** \brief ConfigurationDialog class virtual destructor.
      *
@@ -79,6 +84,36 @@ class ConfigurationDialog
      */
     int numberOfThreads() const;
 
+    /** \brief Returns the size of the read buffer in MiB.
+     *
+     */
+    int bufferSize() const
+    { return m_bufferSize->value(); }
+
+    /** \brief Returns true if the 'memory mapped files' checkbox is checked.
+     *
+     */
+    bool memoryMapChecked() const
+    { return m_memoryMap->isChecked(); }
+
+    /** \brief Returns true if the 'extended attributes' checkbox is checked.
+     *
+     */
+    bool attributesChecked() const
+    { return m_attributes->isChecked(); }
+
+    /** \brief Returns true if the 'Merkle tree' checkbox is checked.
+     *
+     */
+    bool merkleChecked() const
+    { return m_merkle->isChecked(); }
+
+    /** \brief Returns the size of the chunks of the Merkle tree in MiB.
+     *
+     */
+    int chunkSize() const
+    { return m_chunkSize->value(); }
+
   private slots:
     /** \brief Installs or removes the 'Send To' link in the system.
      *
@@ -90,6 +125,11 @@ class ConfigurationDialog
      */
     void onThreadsCheckboxStateChanged();
 
+    /** \brief Enables or disables the chunk size when the user checks the Merkle tree checkbox.
+     *
+     */
+    void onMerkleCheckboxStateChanged();
+
   private:
     /** \brief Updates the 'Send To' UI.
      *
@@ -105,6 +145,11 @@ class ConfigurationDialog
     bool m_splitHash;  /** initial value for 'split hashes' checkbox. */
     bool m_uppercase;  /** initial value for 'uppercase' checkbox.    */
     int  m_numThreads; /** number of threads initial value.           */
+    int  m_bufferMiB;  /** read buffer size initial value.            */
+    bool m_useMap;     /** initial value for 'memory map' checkbox.   */
+    bool m_useXattr;   /** initial value for 'attributes' checkbox.   */
+    bool m_useTree;    /** initial value for 'Merkle tree' checkbox.  */
+    int  m_chunkMiB;   /** Merkle tree chunk size initial value.      */
 };
 
 #endif // CONFIGURATIONDIALOG_H_
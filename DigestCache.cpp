@@ -0,0 +1,197 @@
+/*
+ File: DigestCache.cpp
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Project
+#include <DigestCache.h>
+
+// Qt
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+
+// C++
+#include <algorithm>
+#include <vector>
+
+#ifdef Q_OS_WIN
+#include <windows.h>
+#else
+#include <sys/stat.h>
+#endif
+
+/** Identifies the cache files and the version of their format. */
+static const quint32 CACHE_MAGIC   = 0x53484443;
+static const quint32 CACHE_VERSION = 1;
+
+/** Minimum change in seconds of the last use of an entry to rewrite the cache, one day. */
+static const qint64 USED_RESOLUTION = 24 * 60 * 60;
+
+//----------------------------------------------------------------
+DigestCache::DigestCache(const QString &filename)
+: m_filename{filename}
+, m_modified{false}
+{
+  load();
+}
+
+//----------------------------------------------------------------
+DigestCache::~DigestCache()
+{
+  save();
+}
+
+//----------------------------------------------------------------
+bool DigestCache::fileKey(const QString &filename, FileKey &key)
+{
+#ifdef Q_OS_WIN
+  const auto path = QDir::toNativeSeparators(filename).toStdWString();
+  auto handle = ::CreateFileW(path.c_str(), 0, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS, nullptr);
+  if(handle == INVALID_HANDLE_VALUE) return false;
+
+  BY_HANDLE_FILE_INFORMATION information;
+  const auto success = ::GetFileInformationByHandle(handle, &information);
+  ::CloseHandle(handle);
+
+  if(!success) return false;
+
+  // the write time is in intervals of 100 nanoseconds.
+  key.device = information.dwVolumeSerialNumber;
+  key.inode  = (static_cast<quint64>(information.nFileIndexHigh) << 32) | information.nFileIndexLow;
+  key.size   = (static_cast<quint64>(information.nFileSizeHigh) << 32) | information.nFileSizeLow;
+  key.mtime  = ((static_cast<qint64>(information.ftLastWriteTime.dwHighDateTime) << 32) | information.ftLastWriteTime.dwLowDateTime) * 100;
+#else
+  struct stat information;
+  if(::stat(QFile::encodeName(filename).constData(), &information) != 0) return false;
+
+  key.device = information.st_dev;
+  key.inode  = information.st_ino;
+  key.size   = information.st_size;
+#ifdef Q_OS_MACOS
+  key.mtime  = information.st_mtimespec.tv_sec * 1000000000LL + information.st_mtimespec.tv_nsec;
+#else
+  key.mtime  = information.st_mtim.tv_sec * 1000000000LL + information.st_mtim.tv_nsec;
+#endif
+#endif
+
+  return true;
+}
+
+//----------------------------------------------------------------
+bool DigestCache::find(const FileKey &key, const QString &algorithm, QString &digest)
+{
+  auto it = m_entries.find(entryKey(key, algorithm));
+  if(it == m_entries.end()) return false;
+
+  // the least recently used entries are discarded by days, the hits don't rewrite the cache
+  // unless the last use of the entry changes that much.
+  const auto now = QDateTime::currentSecsSinceEpoch();
+  if(now - it->used >= USED_RESOLUTION) m_modified = true;
+
+  it->used = now;
+  digest   = it->digest;
+
+  return true;
+}
+
+//----------------------------------------------------------------
+void DigestCache::insert(const FileKey &key, const QString &algorithm, const QString &digest)
+{
+  m_entries.insert(entryKey(key, algorithm), Entry{digest, QDateTime::currentSecsSinceEpoch()});
+  m_modified = true;
+}
+
+//----------------------------------------------------------------
+bool DigestCache::save()
+{
+  if(!m_modified) return true;
+
+  if(m_entries.size() > MAX_ENTRIES)
+  {
+    std::vector<qint64> times;
+    times.reserve(m_entries.size());
+    for(const auto &entry: m_entries)
+    {
+      times.push_back(entry.used);
+    }
+
+    // keeps the most recently used, the ones used at the limit time can exceed it a little.
+    std::nth_element(times.begin(), times.begin() + (times.size() - MAX_ENTRIES), times.end());
+    const auto limit = times[times.size() - MAX_ENTRIES];
+
+    m_entries.removeIf([limit](const QHash<QByteArray, Entry>::iterator it) { return it->used < limit; });
+  }
+
+  QDir().mkpath(QFileInfo{m_filename}.absolutePath());
+
+  QSaveFile file{m_filename};
+  if(!file.open(QIODevice::WriteOnly)) return false;
+
+  QDataStream stream{&file};
+  stream << CACHE_MAGIC << CACHE_VERSION << static_cast<quint32>(m_entries.size());
+
+  for(auto it = m_entries.cbegin(); it != m_entries.cend(); ++it)
+  {
+    stream << it.key() << it->digest << it->used;
+  }
+
+  if(stream.status() != QDataStream::Ok || !file.commit()) return false;
+
+  m_modified = false;
+  return true;
+}
+
+//----------------------------------------------------------------
+void DigestCache::load()
+{
+  QFile file{m_filename};
+  if(!file.open(QIODevice::ReadOnly)) return;
+
+  QDataStream stream{&file};
+
+  quint32 magic = 0, version = 0, count = 0;
+  stream >> magic >> version >> count;
+
+  if(magic != CACHE_MAGIC || version != CACHE_VERSION) return;
+
+  m_entries.reserve(count);
+  for(quint32 i = 0; i < count && stream.status() == QDataStream::Ok; ++i)
+  {
+    QByteArray key;
+    Entry entry;
+    stream >> key >> entry.digest >> entry.used;
+
+    if(stream.status() == QDataStream::Ok) m_entries.insert(key, entry);
+  }
+}
+
+//----------------------------------------------------------------
+QByteArray DigestCache::entryKey(const FileKey &key, const QString &algorithm)
+{
+  QByteArray result;
+  result.reserve(sizeof(FileKey) + algorithm.size());
+
+  QDataStream stream{&result, QIODevice::WriteOnly};
+  stream << key.device << key.inode << key.size << key.mtime;
+  result.append(algorithm.toUtf8());
+
+  return result;
+}
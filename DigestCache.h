@@ -0,0 +1,171 @@
+/*
+ File: DigestCache.h
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DIGESTCACHE_H_
+#define DIGESTCACHE_H_
+
+// Project
+#include <Hash.h>
+
+// Qt
+#include <QHash>
+#include <QString>
+
+/** \class DigestCache
+ * \brief Persistent cache of the digests of the files. The digests are keyed by the identity
+ *        of the file (device and inode), its size and modification time, so a file that hasn't
+ *        changed since it was hashed doesn't need to be read again.
+ *
+ */
+class DigestCache
+{
+  public:
+    /** \struct FileKey
+     * \brief Identity and state of a file in the file system.
+     *
+     */
+    struct FileKey
+    {
+      quint64 device; /** device or volume of the file.             */
+      quint64 inode;  /** inode or file index in the device.        */
+      quint64 size;   /** size of the file in bytes.                */
+      qint64  mtime;  /** modification time in nanoseconds.         */
+
+      bool operator==(const FileKey &other) const
+      { return device == other.device && inode == other.inode && size == other.size && mtime == other.mtime; }
+    };
+
+    /** \brief DigestCache class constructor. Loads the cache from the given file if it exists.
+     * \param[in] filename cache file name.
+     *
+     */
+    explicit DigestCache(const QString &filename);
+
+    /** \brief DigestCache class destructor. Saves the cache if it has been modified.
+     *
+     */
+    ~DigestCache();
+
+    /** \brief Returns true and the key of the given file if it can be read from the file system.
+     * \param[in] filename file name.
+     * \param[out] key file key.
+     *
+     */
+    static bool fileKey(const QString &filename, FileKey &key);
+
+    /** \brief Returns true and the digest of the given file and algorithm if it's in the cache.
+     * The last use of the entry is updated, but the cache is only rewritten for it once a day.
+     * \param[in] key file key.
+     * \param[in] algorithm hash name.
+     * \param[out] digest hash value.
+     *
+     */
+    bool find(const FileKey &key, const QString &algorithm, QString &digest);
+
+    /** \brief Adds the digest of the given file and algorithm to the cache.
+     * \param[in] key file key.
+     * \param[in] algorithm hash name.
+     * \param[in] digest hash value.
+     *
+     */
+    void insert(const FileKey &key, const QString &algorithm, const QString &digest);
+
+    /** \brief Writes the cache to disk if it has been modified. Returns false on error.
+     *
+     */
+    bool save();
+
+    static const int MAX_ENTRIES = 1 << 20; /** number of digests kept, the least recently used are discarded. */
+
+  private:
+    /** \struct Entry
+     * \brief Cached digest.
+     *
+     */
+    struct Entry
+    {
+      QString digest; /** hash value.                                 */
+      qint64  used;   /** last time the digest was used, in seconds.  */
+    };
+
+    /** \brief Loads the cache from disk, a missing or invalid file leaves it empty.
+     *
+     */
+    void load();
+
+    /** \brief Returns the key of the entries of the given file and algorithm.
+     * \param[in] key file key.
+     * \param[in] algorithm hash name.
+     *
+     */
+    static QByteArray entryKey(const FileKey &key, const QString &algorithm);
+
+    QString                   m_filename; /** cache file name.                      */
+    QHash<QByteArray, Entry>  m_entries;  /** maps file key + algorithm -> digest.  */
+    bool                      m_modified; /** true if the entries haven't been saved. */
+};
+
+/** \class CachedHash
+ * \brief Hash whose value has been read from the digest cache instead of computed.
+ *
+ */
+class CachedHash
+: public Hash
+{
+  public:
+    /** \brief CachedHash class constructor.
+     * \param[in] algorithm algorithm descriptor.
+     * \param[in] digest hash value.
+     *
+     */
+    explicit CachedHash(const Algorithms::Descriptor &algorithm, const QString &digest)
+    : m_algorithm(algorithm)
+    , m_digest   {digest}
+    {};
+
+    /** \brief CachedHash class virtual destructor.
+     *
+     */
+    virtual ~CachedHash()
+    {};
+
+    virtual const int blockSize() const override
+    { return m_algorithm.blockSize; }
+
+    virtual const QString value() const override
+    { return m_digest; }
+
+    virtual const QString name() const override
+    { return QString(m_algorithm.name); }
+
+    virtual Algorithms::Id algorithm() const override
+    { return m_algorithm.id; }
+
+    virtual void finalize() override
+    {};
+
+  private:
+    virtual void process_blocks(const unsigned char *blocks, const unsigned long long number) override
+    {};
+
+    const Algorithms::Descriptor &m_algorithm; /** algorithm of the digest. */
+    const QString                 m_digest;    /** hash value.              */
+};
+
+#endif // DIGESTCACHE_H_
@@ -0,0 +1,129 @@
+/*
+ File: DirectoryWalker.cpp
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Project
+#include <DirectoryWalker.h>
+
+// Qt
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QThread>
+
+// C++
+#include <algorithm>
+
+#ifdef Q_OS_UNIX
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#endif
+
+//----------------------------------------------------------------
+DirectoryWalker::DirectoryWalker(const Callback &callback, const int threadsNum)
+: m_callback{callback}
+, m_abort   {nullptr}
+{
+  // the directories are read from disk, more threads than cores keep more requests in flight.
+  m_pool.setMaxThreadCount(threadsNum == -1 ? std::max(4, QThread::idealThreadCount()) : threadsNum);
+}
+
+//----------------------------------------------------------------
+void DirectoryWalker::walk(const QStringList &directories, const std::atomic<bool> &abort)
+{
+  m_abort = &abort;
+
+  for(const auto &directory: directories)
+  {
+    const auto path = QDir::cleanPath(directory);
+    m_pool.start([this, path]() { walkDirectory(path); });
+  }
+
+  // the tasks of the subdirectories are started before their parent task ends.
+  m_pool.waitForDone();
+  m_abort = nullptr;
+}
+
+//----------------------------------------------------------------
+void DirectoryWalker::walkDirectory(const QString &path)
+{
+  if(*m_abort) return;
+
+  const auto prefix = path.endsWith('/') ? path : path + '/';
+
+#ifdef Q_OS_UNIX
+  // readdir() gets the entries from the kernel in batches (getdents64) and their types, only the
+  // files and the entries of unknown type need a stat() relative to the directory descriptor.
+  auto directory = ::opendir(QFile::encodeName(path).constData());
+  if(!directory) return;
+
+  const auto descriptor = ::dirfd(directory);
+
+  while(!*m_abort)
+  {
+    const auto entry = ::readdir(directory);
+    if(!entry) break;
+
+    const auto name = entry->d_name;
+    if(name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'))) continue;
+
+    const auto filename = prefix + QFile::decodeName(name);
+
+    if(entry->d_type == DT_DIR)
+    {
+      m_pool.start([this, filename]() { walkDirectory(filename); });
+      continue;
+    }
+
+    if(entry->d_type != DT_REG && entry->d_type != DT_UNKNOWN) continue;
+
+    struct stat information;
+    if(::fstatat(descriptor, name, &information, AT_SYMLINK_NOFOLLOW) != 0) continue;
+
+    if(S_ISDIR(information.st_mode))
+    {
+      m_pool.start([this, filename]() { walkDirectory(filename); });
+    }
+    else if(S_ISREG(information.st_mode))
+    {
+      m_callback(filename, information.st_size);
+    }
+  }
+
+  ::closedir(directory);
+#else
+  QDirIterator it{path, QDir::Files | QDir::Dirs | QDir::NoDotAndDotDot | QDir::Hidden | QDir::System | QDir::NoSymLinks};
+
+  while(it.hasNext() && !*m_abort)
+  {
+    it.next();
+    const auto information = it.fileInfo();
+    const auto filename    = prefix + information.fileName();
+
+    if(information.isDir())
+    {
+      m_pool.start([this, filename]() { walkDirectory(filename); });
+    }
+    else if(information.isFile())
+    {
+      m_callback(filename, information.size());
+    }
+  }
+#endif
+}
@@ -0,0 +1,73 @@
+/*
+ File: DirectoryWalker.h
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DIRECTORYWALKER_H_
+#define DIRECTORYWALKER_H_
+
+// Qt
+#include <QString>
+#include <QStringList>
+#include <QThreadPool>
+
+// C++
+#include <atomic>
+#include <functional>
+
+/** \class DirectoryWalker
+ * \brief Enumerates the regular files of directory trees with a pool of threads, one task per
+ *        directory. The files are given to a callback as soon as they are found, so the caller
+ *        can process them while the rest of the tree is being read. Symbolic links aren't
+ *        followed.
+ *
+ */
+class DirectoryWalker
+{
+  public:
+    /** Receives the path and the size in bytes of each file, called from the threads of the pool. */
+    using Callback = std::function<void(const QString &filename, const qint64 size)>;
+
+    /** \brief DirectoryWalker class constructor.
+     * \param[in] callback function called with each file found, must be thread-safe.
+     * \param[in] threadsNum number of threads reading directories or -1 for the ideal number.
+     *
+     */
+    explicit DirectoryWalker(const Callback &callback, const int threadsNum = -1);
+
+    /** \brief Enumerates the files of the given directories and their subdirectories, returns when
+     * all of them have been read or the walk has been aborted.
+     * \param[in] directories root directories.
+     * \param[in] abort abort flag of the walk.
+     *
+     */
+    void walk(const QStringList &directories, const std::atomic<bool> &abort);
+
+  private:
+    /** \brief Reads the given directory, gives its files to the callback and starts a task for
+     * each of its subdirectories.
+     * \param[in] path directory path.
+     *
+     */
+    void walkDirectory(const QString &path);
+
+    Callback                 m_callback; /** function called with each file.           */
+    QThreadPool              m_pool;     /** threads reading the directories.          */
+    const std::atomic<bool> *m_abort;    /** abort flag of the current walk.           */
+};
+
+#endif // DIRECTORYWALKER_H_
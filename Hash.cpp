@@ -20,9 +20,59 @@
 // Project
 #include "Hash.h"
 
+// C++
+#include <algorithm>
+#include <cstring>
+
 //----------------------------------------------------------------
 Hash::Hash()
+: m_bufferLength {0}
+, m_messageLength{0}
+{
+}
+
+//----------------------------------------------------------------
+void Hash::reset()
 {
-  // This file is needed to generate a object file for hash class,
-  // if not present the subclasses won't compile.
+  m_bufferLength  = 0;
+  m_messageLength = 0;
+}
+
+//----------------------------------------------------------------
+void Hash::update(const unsigned char *data, const unsigned long long length)
+{
+  const unsigned long long size = blockSize();
+  auto remaining = length;
+
+  m_messageLength += length;
+
+  // complete the buffered block first.
+  if(m_bufferLength != 0)
+  {
+    const auto bytes = std::min(size - m_bufferLength, remaining);
+    std::memcpy(m_buffer + m_bufferLength, data, bytes);
+    m_bufferLength += bytes;
+    data += bytes;
+    remaining -= bytes;
+
+    if(m_bufferLength != static_cast<int>(size)) return;
+
+    process_blocks(m_buffer, 1);
+    m_bufferLength = 0;
+  }
+
+  // process all the complete blocks in one call.
+  const auto blocks = remaining / size;
+  if(blocks != 0)
+  {
+    process_blocks(data, blocks);
+    data += blocks * size;
+    remaining -= blocks * size;
+  }
+
+  if(remaining != 0)
+  {
+    std::memcpy(m_buffer, data, remaining);
+    m_bufferLength = remaining;
+  }
 }
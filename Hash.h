@@ -20,6 +20,9 @@
 #ifndef HASH_H_
 #define HASH_H_
 
+// Project
+#include <hash/Algorithms.h>
+
 // Qt
 #include <QByteArray>
 #include <QFile>
@@ -54,11 +57,6 @@ class Hash
      */
     virtual const int blockSize() const = 0;
 
-    /** \brief Returns the size of the unit the hash works with. I.E. 8 bof byte and 1 for bit.
-     *
-     */
-    virtual const int bitsPerUnit() const = 0;
-
     /** \brief Returns the hash value as a string.
      *
      */
@@ -69,17 +67,45 @@ class Hash
      */
     virtual const QString name() const = 0;
 
-    /** \brief Resets the hash internal values.
+    /** \brief Returns the identifier of the hash algorithm.
      *
      */
-    virtual void reset() = 0;
+    virtual Algorithms::Id algorithm() const = 0;
 
-    /** \brief Updated the hash with the contents of the buffer.
-     * \param[in] buffer data buffer.
-     * \param[in] message_length length of the message being hashed.
+    /** \brief Resets the hash internal values. Subclasses must call this method
+     * to reset the buffered data.
      *
      */
-    virtual void update(const QByteArray &buffer, const unsigned long long message_length) = 0;
+    virtual void reset();
+
+    /** \brief Updates the hash with the given data. The data can be of any length, the
+     * complete blocks are processed and the remaining bytes are buffered until the next
+     * update or the finalization of the hash.
+     * \param[in] data data buffer.
+     * \param[in] length length of the data buffer in bytes.
+     *
+     */
+    virtual void update(const unsigned char *data, const unsigned long long length);
+
+    /** \brief Processes the buffered data and the padding of the message. The value
+     * of the hash is valid after this call.
+     *
+     */
+    virtual void finalize() = 0;
+
+  protected:
+    /** \brief Updates the hash with the given number of complete blocks.
+     * \param[in] blocks data buffer.
+     * \param[in] number number of blocks in the buffer.
+     *
+     */
+    virtual void process_blocks(const unsigned char *blocks, const unsigned long long number) = 0;
+
+    static const int MAX_BLOCK_SIZE = 256; /** max size of the blocks of the hashes. */
+
+    unsigned char      m_buffer[MAX_BLOCK_SIZE]; /** data not processed yet, less than a block. */
+    int                m_bufferLength;           /** length of the data in the buffer.          */
+    unsigned long long m_messageLength;          /** length of the message in bytes.            */
 };
 
 #endif // HASH_H_
@@ -0,0 +1,142 @@
+/*
+ File: JobQueue.h
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef JOBQUEUE_H_
+#define JOBQUEUE_H_
+
+// C++
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+/** \class JobQueue
+ * \brief Bounded lock-free queue for multiple producers and multiple consumers. Each cell
+ *        has a sequence number that tells the producers and consumers if it can be used.
+ *
+ */
+template<class T>
+class JobQueue
+{
+  public:
+    /** \brief JobQueue class constructor.
+     * \param[in] capacity minimum number of elements of the queue, rounded to the next power of two.
+     *
+     */
+    explicit JobQueue(const std::size_t capacity)
+    : m_mask      {0}
+    , m_enqueuePos{0}
+    , m_dequeuePos{0}
+    {
+      std::size_t size = 2;
+      while(size < capacity) size <<= 1;
+
+      m_mask  = size - 1;
+      m_cells = std::make_unique<Cell[]>(size);
+
+      for(std::size_t i = 0; i < size; ++i)
+      {
+        m_cells[i].sequence.store(i, std::memory_order_relaxed);
+      }
+    }
+
+    /** \brief Adds the value to the queue. Returns true on success and false if the queue is full.
+     * \param[in] value element to add.
+     *
+     */
+    bool push(const T &value)
+    {
+      Cell *cell = nullptr;
+      auto position = m_enqueuePos.load(std::memory_order_relaxed);
+
+      while(true)
+      {
+        cell = &m_cells[position & m_mask];
+        const auto sequence = cell->sequence.load(std::memory_order_acquire);
+        const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+
+        if(difference == 0)
+        {
+          if(m_enqueuePos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+        }
+        else
+        {
+          if(difference < 0) return false;
+
+          position = m_enqueuePos.load(std::memory_order_relaxed);
+        }
+      }
+
+      cell->value = value;
+      cell->sequence.store(position + 1, std::memory_order_release);
+
+      return true;
+    }
+
+    /** \brief Removes the first element of the queue. Returns true on success and false if the queue is empty.
+     * \param[out] value removed element.
+     *
+     */
+    bool pop(T &value)
+    {
+      Cell *cell = nullptr;
+      auto position = m_dequeuePos.load(std::memory_order_relaxed);
+
+      while(true)
+      {
+        cell = &m_cells[position & m_mask];
+        const auto sequence = cell->sequence.load(std::memory_order_acquire);
+        const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+
+        if(difference == 0)
+        {
+          if(m_dequeuePos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+        }
+        else
+        {
+          if(difference < 0) return false;
+
+          position = m_dequeuePos.load(std::memory_order_relaxed);
+        }
+      }
+
+      value = std::move(cell->value);
+      cell->value = T();
+      cell->sequence.store(position + m_mask + 1, std::memory_order_release);
+
+      return true;
+    }
+
+  private:
+    /** \struct Cell
+     * \brief Queue element and its sequence number.
+     *
+     */
+    struct Cell
+    {
+      std::atomic<std::size_t> sequence; /** sequence number of the cell. */
+      T                        value;    /** stored value.                */
+    };
+
+    std::unique_ptr<Cell[]>               m_cells;      /** queue elements.                     */
+    std::size_t                           m_mask;       /** mask for the positions in the queue.*/
+    alignas(64) std::atomic<std::size_t>  m_enqueuePos; /** position of the next push.          */
+    alignas(64) std::atomic<std::size_t>  m_dequeuePos; /** position of the next pop.           */
+};
+
+#endif // JOBQUEUE_H_
@@ -20,15 +20,11 @@
 // Project
 #include <SimpleHasher.h>
 #include <AboutDialog.h>
-#include <hash/MD5.h>
-#include <hash/SHA1.h>
-#include <hash/SHA224.h>
-#include <hash/SHA256.h>
-#include <hash/SHA384.h>
-#include <hash/SHA512.h>
-#include <hash/Tiger.h>
+#include <hash/Algorithms.h>
+#include <hash/MerkleTree.h>
 #include <ComputerThread.h>
 #include <ConfigurationDialog.h>
+#include <DigestCache.h>
 
 // Qt
 #include <QFileDialog>
@@ -44,23 +40,27 @@
 #include <QModelIndex>
 #include <QObject>
 #include <QRegularExpression>
+#include <QStyle>
 #include <QStyleFactory>
 #include <QMimeData>
 #include <QDropEvent>
 #include <QDragEnterEvent>
+#include <QCheckBox>
+#include <QStandardPaths>
+
+// C++
+#include <algorithm>
 
-QString SimpleHasher::STATE_MD5         = QString("MD5 Enabled");
-QString SimpleHasher::STATE_SHA1        = QString("SHA-1 Enabled");
-QString SimpleHasher::STATE_SHA224      = QString("SHA-224 Enabled");
-QString SimpleHasher::STATE_SHA256      = QString("SHA-256 Enabled");
-QString SimpleHasher::STATE_SHA384      = QString("SHA-384 Enabled");
-QString SimpleHasher::STATE_SHA512      = QString("SHA-512 Enabled");
-QString SimpleHasher::STATE_TIGER       = QString("Tiger Enabled");
 QString SimpleHasher::GEOMETRY          = QString("Application Geometry");
 QString SimpleHasher::OPTIONS_ONELINE   = QString("Hash in one line");
 QString SimpleHasher::OPTIONS_UPPERCASE = QString("Hash in uppercase");
 QString SimpleHasher::OPTIONS_SPACES    = QString("Break hash with spaces");
 QString SimpleHasher::THREADS_NUMBER    = QString("Number of simultaneous threads");
+QString SimpleHasher::BUFFER_SIZE       = QString("Read buffer size in MiB");
+QString SimpleHasher::MEMORY_MAP        = QString("Use memory mapped files");
+QString SimpleHasher::ATTRIBUTES        = QString("Store hashes in extended attributes");
+QString SimpleHasher::MERKLE_TREE       = QString("Hash files with a Merkle tree");
+QString SimpleHasher::CHUNK_SIZE        = QString("Merkle tree chunk size in MiB");
 
 const QString NOT_FOUND             = QString("Not found");
 const QString NOT_FOUND_TOOLTIP     = QString("Hash is not in the files passed as argument.");
@@ -69,8 +69,13 @@ const QString NOT_COMPUTED_TOOLTIP  = QString("Hash hasn't been computed.");
 const QString FILE_NOT_FOUND        = QString("File not found, can't compute or check hash.");
 const QString NOT_COMPUTED_YET      = QString("Hash not checked yet.");
 const QString COMPUTED_TOOLTIP      = QString("Hash computed.");
+const QString FOLDER_TOOLTIP        = QString("Folder, its files are added to the table while they are hashed.");
 
 const QString INI_FILENAME = QString("SimpleHasher.ini");
+const QString CACHE_FILENAME = QString("SimpleHasher.cache");
+
+// max number of corrupt chunks listed in the tooltips.
+const int MAX_CORRUPT_CHUNKS = 16;
 
  //----------------------------------------------------------------
 SimpleHasher::SimpleHasher(const QStringList &files, QWidget *parent, Qt::WindowFlags flags)
@@ -81,12 +86,21 @@ SimpleHasher::SimpleHasher(const QStringList &files, QWidget *parent, Qt::Window
 , m_spaces       {true}
 , m_oneline      {false}
 , m_uppercase    {false}
+, m_bufferSize   {4}
+, m_memoryMap    {false}
+, m_attributes   {false}
+, m_merkle       {false}
+, m_chunkSize    {4}
+, m_cache        {std::make_unique<DigestCache>(cacheFilename())}
 , m_taskbarButton{this}
 {
   qRegisterMetaType<const Hash *>("Hash");
   
   setupUi(this);
 
+  createCheckBoxes();
+  m_columns.fill(-1);
+
   // Better bar than the "Universal" default style in Qt6.
   m_progress->setStyle(QStyleFactory::create("windowsvista"));
   m_taskbarButton.setRange(0,100);
@@ -144,13 +158,10 @@ void SimpleHasher::connectSignals()
   connect(m_save,       SIGNAL(pressed()), this, SLOT(onSavePressed()));
   connect(m_options,    SIGNAL(pressed()), this, SLOT(onOptionsPressed()));
 
-  connect(m_md5,    SIGNAL(stateChanged(int)), this, SLOT(onCheckBoxStateChanged()));
-  connect(m_sha1,   SIGNAL(stateChanged(int)), this, SLOT(onCheckBoxStateChanged()));
-  connect(m_sha224, SIGNAL(stateChanged(int)), this, SLOT(onCheckBoxStateChanged()));
-  connect(m_sha256, SIGNAL(stateChanged(int)), this, SLOT(onCheckBoxStateChanged()));
-  connect(m_sha384, SIGNAL(stateChanged(int)), this, SLOT(onCheckBoxStateChanged()));
-  connect(m_sha512, SIGNAL(stateChanged(int)), this, SLOT(onCheckBoxStateChanged()));
-  connect(m_tiger,  SIGNAL(stateChanged(int)), this, SLOT(onCheckBoxStateChanged()));
+  for(auto checkbox: m_checkBoxes)
+  {
+    connect(checkbox, SIGNAL(stateChanged(int)), this, SLOT(onCheckBoxStateChanged()));
+  }
 }
 
 //----------------------------------------------------------------
@@ -180,7 +191,24 @@ void SimpleHasher::onAddFilesPressed()
 {
   static auto directory = QDir::currentPath();
 
-  auto files = QFileDialog::getOpenFileNames(centralWidget(), tr("Add files"), directory);
+  // the file dialogs can't select files and folders at the same time.
+  QMenu menu{centralWidget()};
+  auto addFiles  = menu.addAction(tr("Add files..."));
+  auto addFolder = menu.addAction(tr("Add folder..."));
+
+  auto selected = menu.exec(m_addFile->mapToGlobal(QPoint{0, m_addFile->height()}));
+  if(!selected) return;
+
+  QStringList files;
+  if(selected == addFiles)
+  {
+    files = QFileDialog::getOpenFileNames(centralWidget(), tr("Add files"), directory);
+  }
+  else
+  {
+    const auto folder = QFileDialog::getExistingDirectory(centralWidget(), tr("Add folder"), directory);
+    if(!folder.isEmpty()) files << QDir::cleanPath(folder);
+  }
 
   if(!files.isEmpty())
   {
@@ -218,9 +246,48 @@ void SimpleHasher::onRemoveFilePressed()
   while(!selectedRows.empty())
   {
     m_hashTable->removeRow(selectedRows.front());
+    m_directories.removeOne(m_files.at(selectedRows.front()));
     m_files.removeAt(selectedRows.front());
     selectedRows.erase(selectedRows.begin());
   }
+
+  updateRows();
+}
+
+//----------------------------------------------------------------
+HashSPtr SimpleHasher::createHash(const Algorithms::Descriptor &algorithm, const QString &filename) const
+{
+  if(m_merkle)
+  {
+    // the checked files are hashed with the chunk size of their chunks file, not the configured one.
+    auto chunkSize = m_chunkSize * 1024ULL * 1024ULL;
+    if(m_mode == Mode::CHECK) chunkSize = m_chunkSizes.value(filename, chunkSize);
+
+    return std::make_shared<MerkleTree>(algorithm.create, chunkSize);
+  }
+
+  return algorithm.create();
+}
+
+//----------------------------------------------------------------
+void SimpleHasher::createCheckBoxes()
+{
+  // before the spacer at the end of the group.
+  for(const auto &algorithm: Algorithms::REGISTRY)
+  {
+    auto checkbox = new QCheckBox{tr(algorithm.name), m_hashGroup};
+    checkbox->setToolTip(tr(algorithm.description));
+    checkbox->setChecked(algorithm.enabled);
+
+    horizontalLayout->insertWidget(horizontalLayout->count() - 1, checkbox);
+    m_checkBoxes << checkbox;
+  }
+}
+
+//----------------------------------------------------------------
+bool SimpleHasher::isChecked(const Algorithms::Descriptor &algorithm) const
+{
+  return m_checkBoxes.at(Algorithms::index(algorithm.id))->isChecked();
 }
 
 //----------------------------------------------------------------
@@ -229,19 +296,37 @@ void SimpleHasher::onComputePressed()
   HashList hashes;
 
   QMap<QString, HashList> computations;
+  QMap<QString, HashList> cached;
+
+  m_keys.clear();
+
+  // the rows of the folders are replaced by their files while they are hashed.
+  const auto directories = m_directories;
+  if(!directories.isEmpty())
+  {
+    for(int row = m_files.size() - 1; row >= 0; --row)
+    {
+      if(!directories.contains(m_files.at(row))) continue;
+
+      m_hashTable->removeRow(row);
+      m_files.removeAt(row);
+    }
+
+    m_directories.clear();
+    updateRows();
+  }
 
   for (int row = 0; row < m_files.size(); ++row)
   {
     hashes.clear();
     auto file = m_files.at(row);
 
-    if (m_md5->isChecked()    && !m_results[file].keys().contains("MD5"))     hashes << std::make_shared<MD5>();
-    if (m_sha1->isChecked()   && !m_results[file].keys().contains("SHA-1"))   hashes << std::make_shared<SHA1>();
-    if (m_sha224->isChecked() && !m_results[file].keys().contains("SHA-224")) hashes << std::make_shared<SHA224>();
-    if (m_sha256->isChecked() && !m_results[file].keys().contains("SHA-256")) hashes << std::make_shared<SHA256>();
-    if (m_sha384->isChecked() && !m_results[file].keys().contains("SHA-384")) hashes << std::make_shared<SHA384>();
-    if (m_sha512->isChecked() && !m_results[file].keys().contains("SHA-512")) hashes << std::make_shared<SHA512>();
-    if (m_tiger->isChecked()  && !m_results[file].keys().contains("Tiger"))   hashes << std::make_shared<Tiger>();
+    const auto &computed = m_results[file];
+
+    for(const auto &algorithm: Algorithms::REGISTRY)
+    {
+      if(isChecked(algorithm) && !computed.contains(hashName(algorithm.name))) hashes << createHash(algorithm, file);
+    }
 
     if (!hashes.empty())
     {
@@ -251,7 +336,7 @@ void SimpleHasher::onComputePressed()
 
         for(auto hash: hashes)
         {
-          auto column = m_headers.indexOf(hash->name());
+          auto column = m_columns[Algorithms::index(hash->algorithm())];
           auto item   = dynamic_cast<HashCellItem *>(m_hashTable->item(row, column));
           item->setProgress(0);
           item->setData(Qt::UserRole+1, false);
@@ -273,6 +358,13 @@ void SimpleHasher::onComputePressed()
         }
       }
 
+      // the chunks of the Merkle trees aren't cached, only the digests of the plain hashes.
+      if(!m_merkle)
+      {
+        const auto found = cachedHashes(file, hashes);
+        if(!found.isEmpty()) cached.insert(file, found);
+      }
+
       if(!hashes.isEmpty())
       {
         computations.insert(file, hashes);
@@ -282,13 +374,63 @@ void SimpleHasher::onComputePressed()
 
   if(m_thread) onCancelPressed();
 
-  if(!computations.empty())
+  // the cached digests are shown as if they had been computed.
+  for(auto it = cached.cbegin(); it != cached.cend(); ++it)
+  {
+    for(auto hash: it.value())
+    {
+      if(m_mode == Mode::GENERATE)
+      {
+        m_results[it.key()][hash->name()] = hash;
+        m_save->setEnabled(true);
+      }
+
+      onHashComputed(it.key(), hash.get());
+    }
+  }
+
+  if(!computations.empty() || !directories.isEmpty())
   {
     m_addFile->setEnabled(false);
     m_removeFile->setEnabled(false);
     m_compute->setEnabled(false);
 
-    m_thread = std::make_shared<ComputerThread>(computations, m_threadsNum);
+    m_thread = std::make_shared<ComputerThread>(computations, m_threadsNum, m_bufferSize * 1024 * 1024, m_memoryMap, m_attributes);
+
+    if(!directories.isEmpty())
+    {
+      QList<const Algorithms::Descriptor *> algorithms;
+      for(const auto &algorithm: Algorithms::REGISTRY)
+      {
+        if(isChecked(algorithm)) algorithms << &algorithm;
+      }
+
+      // called from the threads that read the folders, it only uses the cache of the members.
+      const auto merkle    = m_merkle;
+      const auto chunkSize = m_chunkSize * 1024ULL * 1024ULL;
+      auto factory = [this, algorithms, merkle, chunkSize](const QString &filename, HashList &cached)
+      {
+        HashList hashes;
+        for(auto algorithm: algorithms)
+        {
+          if(merkle)
+          {
+            hashes << std::make_shared<MerkleTree>(algorithm->create, chunkSize);
+          }
+          else
+          {
+            hashes << algorithm->create();
+          }
+        }
+
+        if(!merkle) cached = cachedHashes(filename, hashes);
+
+        return hashes;
+      };
+
+      m_thread->setDirectories(directories, factory);
+    }
+
     showProgress();
 
     connect(m_thread.get(), SIGNAL(progress(int)), m_progress, SLOT(setValue(int)));
@@ -299,6 +441,12 @@ void SimpleHasher::onComputePressed()
 
     m_thread->start();
   }
+  else
+  {
+    // all the digests were cached, there is nothing to update.
+    m_keys.clear();
+    m_cache->save();
+  }
 }
 
 //----------------------------------------------------------------
@@ -380,7 +528,7 @@ void SimpleHasher::onSavePressed()
 
     if(toSave.isEmpty()) continue;
 
-    auto filename = hash.remove('-').toUpper() + tr("SUMS.txt");
+    auto filename = hashesFilename(hash);
     auto filepath = outputdir.absoluteFilePath(filename);
 
     hashFilenames << filename;
@@ -405,7 +553,7 @@ void SimpleHasher::onSavePressed()
     {
       auto hashText = m_results[m_files.at(row)][m_headers.at(column)]->value();
       auto name = m_files.at(row).split(QChar('/')).last();
-      const QString toBuffer = hashText.remove('\n').remove(' ').toLower() + QString(" *%1\n").arg(name);
+      const QString toBuffer = hashesLine(m_headers.at(column), hashText, name);
       data.append(toBuffer.toStdString().c_str());
     }
 
@@ -426,6 +574,14 @@ void SimpleHasher::onSavePressed()
     }
 
     file.close();
+
+    if(MerkleTree::isTreeName(hash))
+    {
+      const auto chunksName = chunksFilename(filename);
+      if(!saveChunks(outputdir.absoluteFilePath(chunksName), hash, toSave)) return;
+
+      hashFilenames << chunksName;
+    }
   }
 
   QMessageBox dialog(centralWidget());
@@ -459,13 +615,14 @@ void SimpleHasher::onCheckBoxStateChanged()
 
   QStringList labels = { tr("Filename") };
 
-  if(m_md5->isChecked())    labels << tr("MD5");
-  if(m_sha1->isChecked())   labels << tr("SHA-1");
-  if(m_sha224->isChecked()) labels << tr("SHA-224");
-  if(m_sha256->isChecked()) labels << tr("SHA-256");
-  if(m_sha384->isChecked()) labels << tr("SHA-384");
-  if(m_sha512->isChecked()) labels << tr("SHA-512");
-  if(m_tiger->isChecked())  labels << tr("Tiger");
+  m_columns.fill(-1);
+  for(const auto &algorithm: Algorithms::REGISTRY)
+  {
+    if(!isChecked(algorithm)) continue;
+
+    m_columns[Algorithms::index(algorithm.id)] = labels.size();
+    labels << tr(algorithm.name);
+  }
 
   if(labels.size() == 1 && m_mode != Mode::CHECK)
   {
@@ -486,9 +643,24 @@ void SimpleHasher::onCheckBoxStateChanged()
     }
     else
     {
-      // put a default check, this can happen if loading a settings file with no hash set.
-      m_sha1->setCheckState(Qt::Checked);
-      labels << tr("SHA-1");
+      // put the default checks, this can happen if loading a settings file with no hash set.
+      for(const auto &algorithm: Algorithms::REGISTRY)
+      {
+        if(!algorithm.enabled) continue;
+
+        m_checkBoxes.at(Algorithms::index(algorithm.id))->setCheckState(Qt::Checked);
+        m_columns[Algorithms::index(algorithm.id)] = labels.size();
+        labels << tr(algorithm.name);
+      }
+    }
+  }
+
+  // the Merkle trees are named after the hash of their chunks.
+  if(m_merkle)
+  {
+    for(int i = 1; i < labels.size(); ++i)
+    {
+      labels[i] = MerkleTree::treeName(labels.at(i));
     }
   }
 
@@ -508,6 +680,7 @@ void SimpleHasher::onCheckBoxStateChanged()
     for(int column = 1; column < labels.size(); ++column)
     {
       QString text = (m_mode == Mode::GENERATE) ? NOT_COMPUTED : NOT_FOUND;
+      if(m_directories.contains(m_files.at(row))) text.clear();
 
       bool alreadyComputed = false;
       if(m_results[m_files.at(row)].contains(labels.at(column)))
@@ -551,10 +724,12 @@ void SimpleHasher::onComputationFinished()
     disconnect(m_thread.get(), SIGNAL(progress(int)), &m_taskbarButton, SLOT(setValue(int)));
 
     const auto fileErrors = m_thread->getErrors();    
+    auto results = m_thread->getResults();
+
+    updateCache(results);
 
     if(m_mode == Mode::GENERATE)
     {
-      auto results = m_thread->getResults();
 
       for(int i = 0; i < m_files.size(); ++i)
       {
@@ -610,13 +785,10 @@ void SimpleHasher::loadSettings()
   }
 
   settings->beginGroup("HashAlgorithms");
-  m_md5   ->setChecked(settings->value(STATE_MD5, false).toBool());
-  m_sha1  ->setChecked(settings->value(STATE_SHA1, true).toBool());
-  m_sha224->setChecked(settings->value(STATE_SHA224, false).toBool());
-  m_sha256->setChecked(settings->value(STATE_SHA256, false).toBool());
-  m_sha384->setChecked(settings->value(STATE_SHA384, false).toBool());
-  m_sha512->setChecked(settings->value(STATE_SHA512, false).toBool());
-  m_tiger ->setChecked(settings->value(STATE_TIGER, false).toBool());
+  for(const auto &algorithm: Algorithms::REGISTRY)
+  {
+    m_checkBoxes.at(Algorithms::index(algorithm.id))->setChecked(settings->value(algorithm.settingsKey, algorithm.enabled).toBool());
+  }
   settings->endGroup();
 
   settings->beginGroup("Options");
@@ -624,12 +796,20 @@ void SimpleHasher::loadSettings()
   m_spaces     = settings->value(OPTIONS_SPACES, true).toBool();
   m_uppercase  = settings->value(OPTIONS_UPPERCASE, false).toBool();
   m_threadsNum = settings->value(THREADS_NUMBER, QThreadPool::globalInstance()->maxThreadCount()).toInt();
+  m_bufferSize = settings->value(BUFFER_SIZE, 4).toInt();
+  m_memoryMap  = settings->value(MEMORY_MAP, false).toBool();
+  m_attributes = settings->value(ATTRIBUTES, false).toBool();
+  m_merkle     = settings->value(MERKLE_TREE, false).toBool();
+  m_chunkSize  = settings->value(CHUNK_SIZE, 4).toInt();
   settings->endGroup();
 
   if(m_threadsNum != -1)
   {
     m_threadsNum = std::min(m_threadsNum, QThreadPool::globalInstance()->maxThreadCount());
   }
+
+  m_bufferSize = std::max(1, std::min(m_bufferSize, 16));
+  m_chunkSize  = std::max(1, std::min(m_chunkSize, 256));
 }
 
 //----------------------------------------------------------------
@@ -642,13 +822,21 @@ void SimpleHasher::saveSettings()
   if(m_mode == Mode::GENERATE)
   {
     settings->beginGroup("HashAlgorithms");
-    settings->setValue(STATE_MD5,    m_md5->isChecked());
-    settings->setValue(STATE_SHA1,   m_sha1->isChecked());
-    settings->setValue(STATE_SHA224, m_sha224->isChecked());
-    settings->setValue(STATE_SHA256, m_sha256->isChecked());
-    settings->setValue(STATE_SHA384, m_sha384->isChecked());
-    settings->setValue(STATE_SHA512, m_sha512->isChecked());
-    settings->setValue(STATE_TIGER,  m_tiger->isChecked());
+    bool valid = false;
+    for(const auto &algorithm: Algorithms::REGISTRY)
+    {
+      settings->setValue(algorithm.settingsKey, isChecked(algorithm));
+      valid |= isChecked(algorithm);
+    }
+
+    // the default algorithms are selected if none is.
+    if(!valid)
+    {
+      for(const auto &algorithm: Algorithms::REGISTRY)
+      {
+        if(algorithm.enabled) settings->setValue(algorithm.settingsKey, true);
+      }
+    }
     settings->endGroup();
 
     settings->beginGroup("Options");
@@ -656,15 +844,12 @@ void SimpleHasher::saveSettings()
     settings->setValue(OPTIONS_SPACES,    m_spaces);
     settings->setValue(OPTIONS_UPPERCASE, m_uppercase);
     settings->setValue(THREADS_NUMBER,    m_threadsNum);
+    settings->setValue(BUFFER_SIZE,       m_bufferSize);
+    settings->setValue(MEMORY_MAP,        m_memoryMap);
+    settings->setValue(ATTRIBUTES,        m_attributes);
+    settings->setValue(MERKLE_TREE,       m_merkle);
+    settings->setValue(CHUNK_SIZE,        m_chunkSize);
     settings->endGroup();
-
-    bool valid = false;
-    for(auto checkbox: {m_md5, m_sha1, m_sha224, m_sha256, m_sha384, m_sha512, m_tiger})
-    {
-      valid |= checkbox->isChecked();
-    }
-
-    if(!valid) settings->setValue(STATE_SHA1, true);
   }
 
   settings->sync();
@@ -673,8 +858,8 @@ void SimpleHasher::saveSettings()
 //----------------------------------------------------------------
 void SimpleHasher::onHashComputed(const QString& file, const Hash *hash)
 {
-  auto row      = m_files.indexOf(file);
-  auto column   = m_headers.indexOf(hash->name());
+  auto row      = fileRow(file);
+  auto column   = m_columns[Algorithms::index(hash->algorithm())];
   auto item     = m_hashTable->item(row, column);
   auto itemHash = item->text().remove('\n').remove(' ').toLower();
   auto text     = hash->value();
@@ -710,7 +895,10 @@ void SimpleHasher::onHashComputed(const QString& file, const Hash *hash)
     {
       item->setData(Qt::UserRole+1, false);
       item->setBackground(QColor(200,100,100));
-      item->setToolTip(tr("Incorrect Hash."));
+
+      // the hashes of the chunks of the Merkle trees tell which parts of the file are corrupt.
+      const auto chunks = corruptChunks(file, hash);
+      item->setToolTip(chunks.isEmpty() ? tr("Incorrect Hash.") : tr("Incorrect Hash. Corrupt chunks: %1.").arg(chunks));
     }
 
     for(int i = 1; i < m_hashTable->columnCount(); ++i)
@@ -832,7 +1020,7 @@ void SimpleHasher::saveSelectedHashes()
   for(auto column: indexes.keys())
   {
     auto hash = m_headers.at(column);
-    auto filename = hash.remove('-').toUpper() + tr("SUMS.txt");
+    auto filename = hashesFilename(hash);
     auto filepath = outputDir.absoluteFilePath(filename);
 
     QByteArray data;
@@ -841,7 +1029,7 @@ void SimpleHasher::saveSelectedHashes()
     {
       auto hashText = m_results[m_files.at(row)][m_headers.at(column)]->value();
       auto name = m_files.at(row).split(QChar('/')).last();
-      const QString toBuffer = hashText.remove('\n').remove(' ').toLower() + QString(" *%1\n").arg(name);
+      const QString toBuffer = hashesLine(m_headers.at(column), hashText, name);
       data.append(toBuffer.toStdString().c_str());
     }
 
@@ -879,6 +1067,14 @@ void SimpleHasher::saveSelectedHashes()
     }
 
     file.close();
+
+    if(MerkleTree::isTreeName(hash))
+    {
+      const auto chunksName = chunksFilename(filename);
+      if(!saveChunks(outputDir.absoluteFilePath(chunksName), hash, indexes[column])) return;
+
+      hashFilenames << chunksName;
+    }
   }
 
   QMessageBox dialog(centralWidget());
@@ -920,38 +1116,27 @@ void SimpleHasher::onContextMenuActivated(const QPoint &pos)
 }
 
 //----------------------------------------------------------------
-const QString SimpleHasher::guessHash(QFile &file)
+const Algorithms::Descriptor *SimpleHasher::guessHash(QFile &file)
 {
-  QString result{"Unknown"};
+  // SFV files always contain CRC32 checksums, the first lines can be comments.
+  if(isSFV(file.fileName())) return &Algorithms::descriptor(Algorithms::Id::CRC32);
 
   file.seek(0);
   const auto data = file.readLine(150); // a bit more than the largest of the hashes (512 bits/4 char bits = 128).
 
-  if(data.length() > 32)
+  if(data.length() > 8)
   {
     QRegularExpression reg{"(([a-h]*)([A-H]*)([0-9]*))*"};
     QRegularExpressionMatch match = reg.match(data);
 
     if(reg.captureCount() != -1)
     {
-      auto hash = match.captured(0);
-
-      switch(hash.length())
-      {
-        case 32 : return "MD5";
-        case 40 : return "SHA-1";
-        case 56 : return "SHA-224";
-        case 64 : return "SHA-256";
-        case 96 : return "SHA-384";
-        case 128: return "SHA-512";
-        case 48 : return "Tiger";
-        default:
-          break;
-      }
+      // hashes of the same length are told apart by the name of the SUMS file.
+      return Algorithms::fromSumsFile(QFileInfo{file.fileName()}.fileName(), match.captured(0).length());
     }
   }
 
-  return result;
+  return nullptr;
 }
 
 //----------------------------------------------------------------
@@ -963,12 +1148,22 @@ void SimpleHasher::loadInformation()
   auto parameterFiles = m_files;
   parameterFiles.detach();
   m_files.clear();
+  m_rows.clear();
+  m_directories.clear();
   m_hashTable->setRowCount(0);
   m_results.clear();
+  m_chunks.clear();
+  m_chunkSizes.clear();
+
+  // the SUMS files of the Merkle trees are named after the hash of their chunks, MERKLESHA256SUMS.txt,
+  // and can't be checked at the same time than the SUMS files of the plain hashes.
+  auto isTreeFile = [](const QString &filename) { return QFileInfo{filename}.fileName().toUpper().startsWith("MERKLE"); };
+  const auto merkle = m_merkle;
+  m_merkle = std::any_of(parameterFiles.cbegin(), parameterFiles.cend(), isTreeFile);
 
   blockSignals(true);
   QList<QCheckBox *> checked;
-  for(auto check: {m_md5, m_sha1, m_sha224, m_sha256, m_sha256, m_sha384, m_sha512, m_tiger})
+  for(auto check: m_checkBoxes)
   {
     if(check->isChecked()) checked << check;
     check->setChecked(false);
@@ -986,59 +1181,27 @@ void SimpleHasher::loadInformation()
       continue;
     }
 
-    const auto hash = guessHash(file);
+    auto hash = guessHash(file);
     file.close();
 
-    if(hash.compare("Unknown") == 0)
+    if(!hash)
     {
       fileErrors += tr("%1 error: %2\n").arg(filename).arg("Unknown hash");
     }
-
-    if (hash.compare("MD5") == 0)
-    {
-      m_md5->setChecked(true);
-      parameterHashLengths << 32;
-    }
     else
-      if (hash.compare("SHA-1") == 0)
+      if(isTreeFile(filename) != m_merkle)
       {
-        m_sha1->setChecked(true);
-        parameterHashLengths << 40;
+        fileErrors += tr("%1 error: %2\n").arg(filename).arg("Merkle tree and plain hashes files can't be checked at the same time");
+        hash = nullptr;
       }
-      else
-        if (hash.compare("SHA-224") == 0)
-        {
-          m_sha224->setChecked(true);
-          parameterHashLengths << 56;
-        }
-        else
-          if (hash.compare("SHA-256") == 0)
-          {
-            m_sha256->setChecked(true);
-            parameterHashLengths << 64;
-          }
-          else
-            if (hash.compare("SHA-384") == 0)
-            {
-              m_sha384->setChecked(true);
-              parameterHashLengths << 96;
-            }
-            else
-              if (hash.compare("SHA-512") == 0)
-              {
-                m_sha512->setChecked(true);
-                parameterHashLengths << 128;
-              }
-              else
-                if (hash.compare("Tiger") == 0)
-                {
-                  m_tiger->setChecked(true);
-                  parameterHashLengths << 48;
-                }
-                else
-                  parameterHashLengths << 0;
-
-    hashNameList << hash;
+
+    if(hash)
+    {
+      m_checkBoxes.at(Algorithms::index(hash->id))->setChecked(true);
+    }
+
+    parameterHashLengths << (hash ? hash->digestLength : 0);
+    hashNameList << (hash ? hashName(hash->name) : QString("Unknown"));
   }
 
   blockSignals(false);
@@ -1059,6 +1222,45 @@ void SimpleHasher::loadInformation()
     int begin = 0;
     auto data = file.readAll();
 
+    if(isSFV(filename))
+    {
+      // SFV lines are the file name and the checksum, the lines that start with ';' are comments.
+      QStringList checksums;
+      for(auto line: QString(data).split('\n'))
+      {
+        line = line.trimmed();
+        const auto separator = line.lastIndexOf(' ');
+        if(line.isEmpty() || line.startsWith(';') || separator == -1) continue;
+
+        files << path.absoluteFilePath(line.left(separator).trimmed());
+        checksums << line.mid(separator + 1);
+      }
+
+      file.close();
+
+      if(files.empty())
+      {
+        fileErrors += tr("%1 error: %2\n").arg(filename).arg(tr("File doesn't contains hashes."));
+        continue;
+      }
+
+      addFilesToTable(files);
+
+      const auto column = m_headers.indexOf(hashNameList.at(parameterFiles.indexOf(filename)));
+      for(int i = 0; i < files.size(); ++i)
+      {
+        if(checksums.at(i).length() != 8)
+        {
+          fileErrors += tr("%1 error: %2\n").arg(filename).arg(tr("Error parsing hashes, incorrect checksum length at entry %1.").arg(i + 1));
+          continue;
+        }
+
+        setReferenceHash(m_rows.value(files.at(i), -1), column, checksums.at(i));
+      }
+
+      continue;
+    }
+
     if(data.indexOf('*', begin) != -1)
     {
       while(data.indexOf('*', begin) != -1)
@@ -1081,10 +1283,15 @@ void SimpleHasher::loadInformation()
       auto line = file.readLine();
       while(!line.isEmpty())
       {
-        auto lineParts = QString(line).split(' ');
-        if(lineParts.size() == 2)
+        // the b2sum and coreutils tools separate the hash and the name with two spaces in text mode.
+        const auto text      = QString(line).remove('\r').remove('\n');
+        const auto separator = text.indexOf(' ');
+        if(separator != -1)
         {
-          files << path.absoluteFilePath(lineParts[1]);
+          auto name = text.mid(separator + 1);
+          if(name.startsWith(' ')) name = name.mid(1);
+
+          if(!name.isEmpty()) files << path.absoluteFilePath(name);
         }
 
         line = file.readLine();
@@ -1102,6 +1309,11 @@ void SimpleHasher::loadInformation()
       continue;
     }
 
+    if(m_merkle)
+    {
+      loadChunks(filename, hashNameList.at(parameterFiles.indexOf(filename)));
+    }
+
     QRegularExpression hashexp{"(([a-h]*)([A-H]*)([0-9]*))*"};
 
     begin = 0;
@@ -1120,23 +1332,10 @@ void SimpleHasher::loadInformation()
 
       if(hashexp.captureCount() != -1 && (hashText.length() == length))
       {
-        auto hashText = match.captured(0);
         auto column = m_headers.indexOf(hashNameList.at(parameterFiles.indexOf(filename)));
-        auto row    = m_files.indexOf(files.at(i));
-
-        if(m_oneline)   hashText = hashText.replace('\n', ' ');
-        if(!m_spaces)   hashText = hashText.remove(' ');
-        if(m_uppercase) hashText = hashText.toUpper();
+        auto row    = m_rows.value(files.at(i), -1);
 
-        auto item = m_hashTable->item(row, column);
-        item->setText(hashText);
-        item->setToolTip(NOT_COMPUTED_YET);
-
-        if(m_hashTable->item(row,0)->toolTip() == FILE_NOT_FOUND)
-        {
-          item->setBackground(QColor(200,200,50));
-          item->setToolTip(FILE_NOT_FOUND);
-        }
+        setReferenceHash(row, column, match.captured(0));
         ++i;
       }
       begin = data.indexOf('\n', begin);
@@ -1165,6 +1364,8 @@ void SimpleHasher::loadInformation()
     m_hashGroup->show();
     m_options->show();
 
+    m_merkle = merkle;
+
     for(auto check: checked)
     {
       check->setChecked(true);
@@ -1183,7 +1384,7 @@ void SimpleHasher::loadInformation()
 //----------------------------------------------------------------
 void SimpleHasher::onOptionsPressed()
 {
-  ConfigurationDialog dialog{m_spaces, m_oneline, m_uppercase, m_threadsNum, centralWidget()};
+  ConfigurationDialog dialog{m_spaces, m_oneline, m_uppercase, m_threadsNum, m_bufferSize, m_memoryMap, m_attributes, m_merkle, m_chunkSize, centralWidget()};
 
   if(dialog.exec() == QDialog::Accepted && dialog.isModified())
   {
@@ -1191,6 +1392,11 @@ void SimpleHasher::onOptionsPressed()
     m_oneline    = dialog.splitHashesChecked();
     m_uppercase  = dialog.uppercaseChecked();
     m_threadsNum = dialog.numberOfThreads();
+    m_bufferSize = dialog.bufferSize();
+    m_memoryMap  = dialog.memoryMapChecked();
+    m_attributes = dialog.attributesChecked();
+    m_merkle     = dialog.merkleChecked();
+    m_chunkSize  = dialog.chunkSize();
 
     onCheckBoxStateChanged();
   }
@@ -1208,31 +1414,272 @@ std::unique_ptr<QSettings> SimpleHasher::applicationSettings() const
   return std::make_unique<QSettings>("Felix de las Pozas Alvarez", "SimpleHasher");
 }
 
+//----------------------------------------------------------------
+QString SimpleHasher::cacheFilename() const
+{
+  // the cache of a portable installation is next to its INI file.
+  QDir applicationDir{QCoreApplication::applicationDirPath()};
+  if(applicationDir.exists(INI_FILENAME))
+  {
+    return applicationDir.absoluteFilePath(CACHE_FILENAME);
+  }
+
+  return QDir{QStandardPaths::writableLocation(QStandardPaths::AppLocalDataLocation)}.absoluteFilePath(CACHE_FILENAME);
+}
+
+//----------------------------------------------------------------
+void SimpleHasher::updateCache(const QMap<QString, HashList> &results)
+{
+  for(auto it = results.cbegin(); it != results.cend(); ++it)
+  {
+    if(!m_keys.contains(it.key())) continue;
+
+    // the digests of files modified while being hashed aren't valid for any state of the file.
+    DigestCache::FileKey key;
+    if(!DigestCache::fileKey(it.key(), key) || !(key == m_keys[it.key()])) continue;
+
+    for(auto hash: it.value())
+    {
+      // the digests read from the cache or the attributes are already stored.
+      if(dynamic_cast<CachedHash *>(hash.get())) continue;
+
+      m_cache->insert(key, hash->name(), hash->value());
+    }
+  }
+
+  m_keys.clear();
+  m_cache->save();
+}
+
+//----------------------------------------------------------------
+HashList SimpleHasher::cachedHashes(const QString &filename, HashList &hashes)
+{
+  HashList cached;
+
+  DigestCache::FileKey key;
+  if(hashes.isEmpty() || !DigestCache::fileKey(filename, key)) return cached;
+
+  QMutexLocker lock(&m_cacheMutex);
+  m_keys.insert(filename, key);
+
+  for(auto it = hashes.begin(); it != hashes.end();)
+  {
+    QString digest;
+    if(!m_cache->find(key, (*it)->name(), digest))
+    {
+      ++it;
+      continue;
+    }
+
+    cached << std::make_shared<CachedHash>(Algorithms::descriptor((*it)->algorithm()), digest);
+    it = hashes.erase(it);
+  }
+
+  return cached;
+}
+
+//----------------------------------------------------------------
+void SimpleHasher::setReferenceHash(const int row, const int column, QString hashText)
+{
+  if(m_oneline)   hashText = hashText.replace('\n', ' ');
+  if(!m_spaces)   hashText = hashText.remove(' ');
+  if(m_uppercase) hashText = hashText.toUpper();
+
+  auto item = m_hashTable->item(row, column);
+  item->setText(hashText);
+  item->setToolTip(NOT_COMPUTED_YET);
+
+  if(m_hashTable->item(row,0)->toolTip() == FILE_NOT_FOUND)
+  {
+    item->setBackground(QColor(200,200,50));
+    item->setToolTip(FILE_NOT_FOUND);
+  }
+}
+
+//----------------------------------------------------------------
+QString SimpleHasher::hashesFilename(const QString &hash)
+{
+  const auto isTree    = MerkleTree::isTreeName(hash);
+  const auto algorithm = Algorithms::find(isTree ? MerkleTree::algorithmName(hash) : hash);
+  const QString filename{algorithm->sumsFilename};
+
+  if(!isTree) return filename;
+
+  // the Merkle trees are named after the hash of their chunks, MERKLESHA256SUMS.txt. SFV
+  // files only contain plain checksums.
+  return QString("MERKLE") + (isSFV(filename) ? QFileInfo{filename}.completeBaseName() + "SUMS.txt" : filename);
+}
+
+//----------------------------------------------------------------
+QString SimpleHasher::hashesLine(const QString &hash, QString hashText, const QString &name)
+{
+  hashText = hashText.remove('\n').remove(' ');
+
+  if(isSFV(hashesFilename(hash))) return QString("%1 %2\n").arg(name).arg(hashText.toUpper());
+
+  return hashText.toLower() + QString(" *%1\n").arg(name);
+}
+
+//----------------------------------------------------------------
+bool SimpleHasher::isSFV(const QString &filename)
+{
+  return QFileInfo{filename}.suffix().compare("sfv", Qt::CaseInsensitive) == 0;
+}
+
+//----------------------------------------------------------------
+QString SimpleHasher::chunksFilename(const QString &filename)
+{
+  return QString(filename).replace("SUMS", "CHUNKS");
+}
+
+//----------------------------------------------------------------
+bool SimpleHasher::saveChunks(const QString &filepath, const QString &hash, const QList<int> &rows)
+{
+  // the chunk size before the chunks built with it, the lines that start with ';' are comments like
+  // in the SFV files. The trees can have different sizes, the checked files keep their chunks file size.
+  QByteArray data;
+  unsigned long long chunkSize = 0;
+
+  for(auto row: rows)
+  {
+    const auto tree = std::dynamic_pointer_cast<MerkleTree>(m_results[m_files.at(row)][hash]);
+    if(!tree) continue;
+
+    if(tree->chunkSize() != chunkSize)
+    {
+      chunkSize = tree->chunkSize();
+      data.append(QString("; chunk size %1\n").arg(chunkSize).toUtf8());
+    }
+
+    const auto name   = m_files.at(row).split(QChar('/')).last();
+    const auto values = tree->chunkValues();
+    for(int i = 0; i < values.size(); ++i)
+    {
+      data.append(QString("%1 %2 *%3\n").arg(values.at(i)).arg(i).arg(name).toUtf8());
+    }
+  }
+
+  QFile file{filepath};
+  if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate) || (file.write(data) != data.size()) || !file.flush())
+  {
+    QMessageBox dialog(centralWidget());
+    dialog.setWindowIcon(QIcon(":/SimpleHasher/application.svg"));
+    dialog.setWindowTitle(tr("Error saving hashes"));
+    dialog.setText(tr("Couldn't create file '%1'.").arg(QFileInfo{filepath}.fileName()));
+    dialog.setDetailedText(tr("Error: ") + file.errorString());
+    dialog.setIcon(QMessageBox::Icon::Warning);
+
+    dialog.exec();
+
+    file.close();
+    QFile::remove(filepath);
+    return false;
+  }
+
+  file.close();
+
+  return true;
+}
+
+//----------------------------------------------------------------
+void SimpleHasher::loadChunks(const QString &filename, const QString &hash)
+{
+  const QFileInfo info{filename};
+  const auto path = info.absoluteDir();
+
+  QFile file{path.absoluteFilePath(chunksFilename(info.fileName()))};
+  if(!file.exists() || !file.open(QIODevice::ReadOnly|QIODevice::Text)) return;
+
+  const QRegularExpression sizeExp{"^; chunk size (\\d+)$"};
+  unsigned long long chunkSize = 0;
+
+  for(auto line: QString(file.readAll()).split('\n'))
+  {
+    line = line.remove('\r');
+
+    const auto sizeMatch = sizeExp.match(line);
+    if(sizeMatch.hasMatch())
+    {
+      // the chunks are hashed again with the size they were saved with.
+      chunkSize = sizeMatch.captured(1).toULongLong();
+      continue;
+    }
+
+    // the lines are the hash of the chunk, its index and the name of the file.
+    const auto first  = line.indexOf(' ');
+    const auto second = line.indexOf(" *", first + 1);
+    if(line.startsWith(';') || first == -1 || second == -1) continue;
+
+    bool ok = false;
+    const auto index = line.mid(first + 1, second - first - 1).toInt(&ok);
+    const auto name  = path.absoluteFilePath(line.mid(second + 2));
+    auto &values = m_chunks[name][hash];
+
+    if(!ok || index != values.size()) continue;
+
+    values << line.left(first).toLower();
+    if(chunkSize > 0) m_chunkSizes[name] = chunkSize;
+  }
+
+  file.close();
+}
+
+//----------------------------------------------------------------
+QString SimpleHasher::corruptChunks(const QString &filename, const Hash *hash) const
+{
+  const auto tree      = dynamic_cast<const MerkleTree *>(hash);
+  const auto reference = m_chunks.value(filename).value(hash->name());
+  if(!tree || reference.isEmpty()) return QString();
+
+  const auto values = tree->chunkValues();
+  const auto number = std::max(reference.size(), values.size());
+
+  // the chunks that aren't in both lists are also corrupt, the file has grown or shrunk.
+  QStringList corrupt;
+  int count = 0;
+  for(int i = 0; i < number; ++i)
+  {
+    if(i >= reference.size() || i >= values.size() || reference.at(i) != values.at(i))
+    {
+      if(++count <= MAX_CORRUPT_CHUNKS) corrupt << QString::number(i);
+    }
+  }
+
+  if(count > MAX_CORRUPT_CHUNKS) corrupt << tr("... (%1 of %2 chunks)").arg(count).arg(number);
+
+  return corrupt.join(", ");
+}
+
+//----------------------------------------------------------------
+QString SimpleHasher::hashName(const QString &algorithm) const
+{
+  return m_merkle ? MerkleTree::treeName(algorithm) : algorithm;
+}
+
 //----------------------------------------------------------------
 void SimpleHasher::addFilesToTable(const QStringList &files)
 {
   m_hashTable->setEnabled(true);
 
-  int columnCount = 1;
-  if(m_md5->isChecked())    ++columnCount;
-  if(m_sha1->isChecked())   ++columnCount;
-  if(m_sha224->isChecked()) ++columnCount;
-  if(m_sha256->isChecked()) ++columnCount;
-  if(m_sha384->isChecked()) ++columnCount;
-  if(m_sha512->isChecked()) ++columnCount;
-  if(m_tiger->isChecked())  ++columnCount;
+  auto isSelected = [this](const Algorithms::Descriptor &algorithm) { return isChecked(algorithm); };
+  const int columnCount = 1 + std::count_if(std::begin(Algorithms::REGISTRY), std::end(Algorithms::REGISTRY), isSelected);
 
   for(auto file: files)
   {
-    if(m_files.contains(file))
+    if(m_rows.contains(file))
       continue;
 
+    const QFileInfo info{file};
+    const auto isDirectory = (m_mode == Mode::GENERATE) && info.isDir();
+
+    m_rows.insert(file, m_files.size());
     m_files << file;
+    if(isDirectory) m_directories << file;
 
     auto row      = m_hashTable->rowCount();
     auto filename = file.split(QChar('/')).last();
     auto item     = new QTableWidgetItem(filename);
-    auto exists   = QFileInfo{file}.exists();
+    auto exists   = info.exists();
 
     auto itemFont = item->font();
     itemFont.setBold(true);
@@ -1242,6 +1689,11 @@ void SimpleHasher::addFilesToTable(const QStringList &files)
       item->setIcon(QIcon(":/SimpleHasher/warning.svg"));
       item->setToolTip(FILE_NOT_FOUND);
     }
+    else if(isDirectory)
+    {
+      item->setIcon(style()->standardIcon(QStyle::SP_DirIcon));
+      item->setToolTip(FOLDER_TOOLTIP);
+    }
 
     m_hashTable->insertRow(row);
     m_hashTable->setItem(row, 0, item);
@@ -1255,7 +1707,11 @@ void SimpleHasher::addFilesToTable(const QStringList &files)
       item->setTextAlignment(Qt::AlignCenter);
 
       QString text,tooltip;
-      if(m_results[file].contains(m_headers.at(column-1)))
+      if(isDirectory)
+      {
+        tooltip = FOLDER_TOOLTIP;
+      }
+      else if(m_results[file].contains(m_headers.at(column-1)))
       {
         auto hash = m_results[file][m_headers.at(column-1)];
         text = hash->value();
@@ -1289,6 +1745,53 @@ void SimpleHasher::addFilesToTable(const QStringList &files)
   m_compute->setEnabled(enabled);
 }
 
+//----------------------------------------------------------------
+int SimpleHasher::fileRow(const QString &filename)
+{
+  const auto it = m_rows.constFind(filename);
+  if(it != m_rows.constEnd()) return it.value();
+
+  // a file of the folders being hashed, the buttons stay disabled until the computation ends.
+  const auto row = m_files.size();
+  m_rows.insert(filename, row);
+  m_files << filename;
+
+  auto item = new QTableWidgetItem(filename.split(QChar('/')).last());
+  auto itemFont = item->font();
+  itemFont.setBold(true);
+  item->setFont(itemFont);
+  item->setToolTip(filename);
+
+  m_hashTable->insertRow(row);
+  m_hashTable->setItem(row, 0, item);
+
+  for(int column = 1; column < m_headers.size(); ++column)
+  {
+    auto cell = new HashCellItem{NOT_COMPUTED};
+    cell->setProgress(0);
+    cell->setData(Qt::UserRole+1, false);
+    cell->setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+    cell->setTextAlignment(Qt::AlignCenter);
+    cell->setToolTip(NOT_COMPUTED_TOOLTIP);
+
+    m_hashTable->setItem(row, column, cell);
+  }
+
+  return row;
+}
+
+//----------------------------------------------------------------
+void SimpleHasher::updateRows()
+{
+  m_rows.clear();
+  m_rows.reserve(m_files.size());
+
+  for(int row = 0; row < m_files.size(); ++row)
+  {
+    m_rows.insert(m_files.at(row), row);
+  }
+}
+
 //----------------------------------------------------------------
 void SimpleHasher::setMode(const Mode mode)
 {
@@ -1296,6 +1799,8 @@ void SimpleHasher::setMode(const Mode mode)
   m_mode = mode;
 
   m_results.clear();
+  m_rows.clear();
+  m_directories.clear();
   m_hashTable->setRowCount(0);
 
   const auto isGenerate = (m_mode == Mode::GENERATE);
@@ -1336,7 +1841,7 @@ void SimpleHasher::dropEvent(QDropEvent *e)
     QStringList filesToAdd;
     const auto urlList = e->mimeData()->urls();
 
-    if(urlList.count() == 1 && urlList.first().toLocalFile().contains("SUMS"))
+    if(urlList.count() == 1 && (urlList.first().toLocalFile().contains("SUMS") || isSFV(urlList.first().toLocalFile())))
     {
       m_files.clear();
       m_files << urlList.first().toLocalFile();
@@ -1347,6 +1852,7 @@ void SimpleHasher::dropEvent(QDropEvent *e)
     setMode(Mode::GENERATE);
     for(QUrl &url : e->mimeData()->urls())
     {
+      // the folders are read while their files are hashed.
       QFileInfo fInfo{url.toLocalFile()};
       if(fInfo.exists())
         filesToAdd << fInfo.absoluteFilePath();
@@ -1410,8 +1916,8 @@ void SimpleHasher::onHashUpdated(const QString& filename, const Hash* hash, cons
 {
   if(value != 100)
   {
-    auto row      = m_files.indexOf(filename);
-    auto column   = m_headers.indexOf(hash->name());
+    auto row      = fileRow(filename);
+    auto column   = m_columns[Algorithms::index(hash->algorithm())];
     auto item     = dynamic_cast<HashCellItem *>(m_hashTable->item(row, column));
     if(item) item->setProgress(value);
   }
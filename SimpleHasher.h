@@ -22,15 +22,19 @@
 
 // Qt
 #include "ui_SimpleHasher.h"
+#include <QHash>
 #include <QMainWindow>
+#include <QMutex>
 #include <QStyledItemDelegate>
 #include <QTableWidgetItem>
 
 // C++
+#include <array>
 #include <memory>
 
 // Project
 #include <Hash.h>
+#include <DigestCache.h>
 #include <external\QTaskBarButton.h>
 
 class ComputerThread;
@@ -39,6 +43,7 @@ class QPainter;
 class QStyleOptionViewItem;
 class QModelItem;
 class QSettings;
+class QCheckBox;
 
 /** \class SimpleHasher
  * \brief Application main window class.
@@ -74,7 +79,8 @@ class SimpleHasher
      */
     void onAboutPressed();
 
-    /** \brief Launches the add files dialog and adds the files specified by the user to the table.
+    /** \brief Launches the add files or the add folder dialog and adds the files or the folder
+     * specified by the user to the table.
      *
      */
     void onAddFilesPressed();
@@ -151,6 +157,27 @@ class SimpleHasher
      */
     std::unique_ptr<QSettings> applicationSettings() const;
 
+    /** \brief Returns the name of the digest cache file, next to the INI file if it's present.
+     *
+     */
+    QString cacheFilename() const;
+
+    /** \brief Adds the computed digests of the files that haven't changed since the computation
+     * started to the digest cache.
+     * \param[in] results computed hashes of each file.
+     *
+     */
+    void updateCache(const QMap<QString, HashList> &results);
+
+    /** \brief Removes the hashes whose digests are in the digest cache from the given ones and
+     * returns them with their cached values. The key of the file is kept to update the cache when
+     * the computation ends. Called from the threads that read the folders too.
+     * \param[in] filename file name.
+     * \param[inout] hashes hash objects to compute.
+     *
+     */
+    HashList cachedHashes(const QString &filename, HashList &hashes);
+
     /** \class Mode
      * \brief Enumeration of application operation mode.
      *
@@ -158,18 +185,16 @@ class SimpleHasher
     enum class Mode: char { GENERATE = 0, CHECK = 1, NONE = 2 };
 
     /** Settings strings. */
-    static QString STATE_MD5;
-    static QString STATE_SHA1;
-    static QString STATE_SHA224;
-    static QString STATE_SHA256;
-    static QString STATE_SHA384;
-    static QString STATE_SHA512;
-    static QString STATE_TIGER;
     static QString GEOMETRY;
     static QString OPTIONS_ONELINE;
     static QString OPTIONS_UPPERCASE;
     static QString OPTIONS_SPACES;
     static QString THREADS_NUMBER;
+    static QString BUFFER_SIZE;
+    static QString MEMORY_MAP;
+    static QString ATTRIBUTES;
+    static QString MERKLE_TREE;
+    static QString CHUNK_SIZE;
 
     /** \brief Helper method to load the application settings from the ini file.
      *
@@ -206,34 +231,149 @@ class SimpleHasher
      */
     void loadInformation();
 
-    /** \brief Returns a string that describes the type of hash detected in the file passed as argument.
+    /** \brief Returns the algorithm of the hashes detected in the file passed as argument, or nullptr
+     * if it's unknown.
      * \param[in] file opened file object.
      *
      */
-    const QString guessHash(QFile &file);
+    const Algorithms::Descriptor *guessHash(QFile &file);
+
+    /** \brief Shows the hash read from a hashes file in the given cell of the table.
+     * \param[in] row table row.
+     * \param[in] column table column.
+     * \param[in] hashText hash value.
+     *
+     */
+    void setReferenceHash(const int row, const int column, QString hashText);
+
+    /** \brief Returns the name of the file to save the hashes of the given algorithm. CRC32
+     * checksums are saved as a SFV file.
+     * \param[in] hash hash name.
+     *
+     */
+    QString hashesFilename(const QString &hash);
 
-    /** \brief Helper method to add a list of files to the table.
+    /** \brief Returns the line of the hashes file for the given file.
+     * \param[in] hash hash name.
+     * \param[in] hashText hash value.
+     * \param[in] name file name.
+     *
+     */
+    QString hashesLine(const QString &hash, QString hashText, const QString &name);
+
+    /** \brief Returns true if the given file is a Simple File Verification (SFV) file.
+     * \param[in] filename file name.
+     *
+     */
+    static bool isSFV(const QString &filename);
+
+    /** \brief Returns the name of the file with the hashes of the chunks of the Merkle trees
+     * saved in the given hashes file.
+     * \param[in] filename hashes file name.
+     *
+     */
+    static QString chunksFilename(const QString &filename);
+
+    /** \brief Saves the hashes of the chunks of the Merkle trees of the given files. Returns
+     * false and shows the error if the file can't be written.
+     * \param[in] filepath chunks file path.
+     * \param[in] hash Merkle tree name.
+     * \param[in] rows rows of the files in the table.
+     *
+     */
+    bool saveChunks(const QString &filepath, const QString &hash, const QList<int> &rows);
+
+    /** \brief Loads the hashes of the chunks of the Merkle trees of the given hashes file, if
+     * its chunks file exists.
+     * \param[in] filename hashes file name.
+     * \param[in] hash Merkle tree name.
+     *
+     */
+    void loadChunks(const QString &filename, const QString &hash);
+
+    /** \brief Returns the indexes of the chunks whose hashes don't match the loaded ones, or an
+     * empty string if there are no loaded hashes for the file.
+     * \param[in] filename file name.
+     * \param[in] hash computed hash object.
+     *
+     */
+    QString corruptChunks(const QString &filename, const Hash *hash) const;
+
+    /** \brief Returns the column name of the given hash algorithm, the Merkle tree of the
+     * algorithm in Merkle tree mode.
+     * \param[in] algorithm hash algorithm name.
+     *
+     */
+    QString hashName(const QString &algorithm) const;
+
+    /** \brief Returns a new hash object of the given algorithm, or a Merkle tree of that hash in
+     * Merkle tree mode. The trees of the checked files use the chunk size of their chunks file.
+     * \param[in] algorithm algorithm descriptor.
+     * \param[in] filename name of the file to hash.
+     *
+     */
+    HashSPtr createHash(const Algorithms::Descriptor &algorithm, const QString &filename) const;
+
+    /** \brief Creates the check boxes of the algorithms of the registry in the hash group.
+     *
+     */
+    void createCheckBoxes();
+
+    /** \brief Returns true if the given algorithm is selected.
+     * \param[in] algorithm algorithm descriptor.
+     *
+     */
+    bool isChecked(const Algorithms::Descriptor &algorithm) const;
+
+    /** \brief Helper method to add a list of files to the table. The folders are shown in a row
+     * until the hashes are computed, their files are added to the table while they are hashed.
      *
      */
     void addFilesToTable(const QStringList &files);
 
+    /** \brief Returns the row of the file in the table. The files found in the folders being hashed
+     * are added to the table the first time they are reported.
+     * \param[in] filename file name.
+     *
+     */
+    int fileRow(const QString &filename);
+
+    /** \brief Updates the rows of the files after removing rows of the table.
+     *
+     */
+    void updateRows();
+
     /** \brief Updates the UI depending on the given mode.
      * \param[in] mode Operation mode.
      *
      */
     void setMode(const Mode mode);
 
-    Mode                                   m_mode;          /** operation mode.                                                 */
-    QStringList                            m_files;         /** files in the table.                                             */
-    std::shared_ptr<ComputerThread>        m_thread;        /** computer thread.                                                */
-    bool                                   m_spaces;        /** true to divide the hashes with spaces.                          */
-    bool                                   m_oneline;       /** true to show the long hashes in one line.                       */
-    bool                                   m_uppercase;     /** true to show the hashes in uppercase.                           */
-    int                                    m_threadsNum;    /** number of simultaneous threads to compute hashes.               */
-    QMap<QString, QMap<QString, HashSPtr>> m_results;       /** maps files -> computed hashes.                                  */
-    QStringList                            m_headers;       /** list of column strings, just to avoid computing over and over.. */
-    std::shared_ptr<QMenu>                 m_menu;          /** contextual menu for the table.                                  */
-    QTaskBarButton                         m_taskbarButton; /** taskbar button for progress reporting.                          */
+    Mode                                      m_mode;          /** operation mode.                                                 */
+    QStringList                               m_files;         /** files in the table.                                             */
+    QHash<QString, int>                       m_rows;          /** maps files -> row in the table.                                 */
+    QStringList                               m_directories;   /** folders in the table, hashed with the computer thread.          */
+    std::shared_ptr<ComputerThread>           m_thread;        /** computer thread.                                                */
+    bool                                      m_spaces;        /** true to divide the hashes with spaces.                          */
+    bool                                      m_oneline;       /** true to show the long hashes in one line.                       */
+    bool                                      m_uppercase;     /** true to show the hashes in uppercase.                           */
+    int                                       m_threadsNum;    /** number of simultaneous threads to compute hashes.               */
+    int                                       m_bufferSize;    /** size of the read buffer of each thread in MiB.                  */
+    bool                                      m_memoryMap;     /** true to map the files in memory instead of reading them.        */
+    bool                                      m_attributes;    /** true to store the hashes in the extended attributes of files.   */
+    bool                                      m_merkle;        /** true to hash the files in chunks with a Merkle tree.            */
+    int                                       m_chunkSize;     /** size of the chunks of the Merkle trees in MiB.                  */
+    QMap<QString, QMap<QString, QStringList>> m_chunks;        /** maps files -> Merkle tree -> loaded hashes of the chunks.       */
+    QMap<QString, unsigned long long>         m_chunkSizes;    /** maps checked files -> chunk size in bytes of their chunks file. */
+    QMap<QString, QMap<QString, HashSPtr>>    m_results;       /** maps files -> computed hashes.                                  */
+    QStringList                               m_headers;       /** list of column strings, just to avoid computing over and over.. */
+    std::array<int, Algorithms::COUNT>        m_columns;       /** column of each algorithm in the table or -1 if it isn't shown.  */
+    QList<QCheckBox *>                        m_checkBoxes;    /** check box of each algorithm, in registry order.                 */
+    std::unique_ptr<DigestCache>              m_cache;         /** persistent cache of the digests of the files.                   */
+    QMap<QString, DigestCache::FileKey>       m_keys;          /** keys of the files being hashed, to update the cache.            */
+    QMutex                                    m_cacheMutex;    /** protects the cache and the keys while the folders are read.     */
+    std::shared_ptr<QMenu>                    m_menu;          /** contextual menu for the table.                                  */
+    QTaskBarButton                            m_taskbarButton; /** taskbar button for progress reporting.                          */
 };
 
 /** \class HashCellItem
@@ -0,0 +1,118 @@
+/*
+ File: Algorithms.cpp
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Project
+#include <hash/Algorithms.h>
+#include <hash/MD5.h>
+#include <hash/SHA1.h>
+#include <hash/SHA224.h>
+#include <hash/SHA256.h>
+#include <hash/SHA384.h>
+#include <hash/SHA512.h>
+#include <hash/SHA512t.h>
+#include <hash/Tiger.h>
+#include <hash/BLAKE3.h>
+#include <hash/XXH3.h>
+#include <hash/XXH128.h>
+#include <hash/CRC32.h>
+#include <hash/CRC32C.h>
+#include <hash/BLAKE2b.h>
+#include <hash/BLAKE2bp.h>
+#include <hash/BLAKE2sp.h>
+#include <hash/SHA3.h>
+#include <hash/KangarooTwelve.h>
+
+//----------------------------------------------------------------
+template<class T> std::shared_ptr<Hash> Algorithms::create()
+{
+  return std::make_shared<T>();
+}
+
+template std::shared_ptr<Hash> Algorithms::create<MD5>();
+template std::shared_ptr<Hash> Algorithms::create<SHA1>();
+template std::shared_ptr<Hash> Algorithms::create<SHA224>();
+template std::shared_ptr<Hash> Algorithms::create<SHA256>();
+template std::shared_ptr<Hash> Algorithms::create<SHA384>();
+template std::shared_ptr<Hash> Algorithms::create<SHA512>();
+template std::shared_ptr<Hash> Algorithms::create<Tiger>();
+template std::shared_ptr<Hash> Algorithms::create<BLAKE3>();
+template std::shared_ptr<Hash> Algorithms::create<XXH3>();
+template std::shared_ptr<Hash> Algorithms::create<XXH128>();
+template std::shared_ptr<Hash> Algorithms::create<CRC32>();
+template std::shared_ptr<Hash> Algorithms::create<CRC32C>();
+template std::shared_ptr<Hash> Algorithms::create<BLAKE2b>();
+template std::shared_ptr<Hash> Algorithms::create<BLAKE2bp>();
+template std::shared_ptr<Hash> Algorithms::create<BLAKE2sp>();
+template std::shared_ptr<Hash> Algorithms::create<SHA3_256>();
+template std::shared_ptr<Hash> Algorithms::create<SHA3_384>();
+template std::shared_ptr<Hash> Algorithms::create<SHA3_512>();
+template std::shared_ptr<Hash> Algorithms::create<SHAKE128>();
+template std::shared_ptr<Hash> Algorithms::create<SHAKE256>();
+template std::shared_ptr<Hash> Algorithms::create<KangarooTwelve>();
+template std::shared_ptr<Hash> Algorithms::create<SHA512_256>();
+template std::shared_ptr<Hash> Algorithms::create<SHA512_224>();
+
+//----------------------------------------------------------------
+const Algorithms::Descriptor *Algorithms::find(const QString &name)
+{
+  for(const auto &algorithm: REGISTRY)
+  {
+    if(name.compare(algorithm.name) == 0) return &algorithm;
+  }
+
+  return nullptr;
+}
+
+//----------------------------------------------------------------
+const Algorithms::Descriptor *Algorithms::fromSumsFile(const QString &filename, const int digestLength)
+{
+  // the separators of the names are lost in the saved files, SHA-512/256 is SHA512_256SUMS.txt.
+  auto compact = [](const QString &text) { return QString(text).toUpper().remove('-').remove('_'); };
+
+  const auto name = compact(filename);
+  const Descriptor *result = nullptr;
+  int matchLength = 0;
+
+  // the first algorithm with the digest length is the default, the longest name in the file
+  // name tells apart those that are prefixes of others, like BLAKE2b and BLAKE2bp.
+  for(const auto &algorithm: REGISTRY)
+  {
+    if(algorithm.digestLength != digestLength) continue;
+
+    if(!result) result = &algorithm;
+
+    const auto sumsName = compact(algorithm.sumsFilename);
+    const auto tag      = sumsName.left(sumsName.indexOf(sumsName.contains("SUMS") ? "SUMS" : "."));
+
+    if(name.contains(tag) && tag.length() > matchLength)
+    {
+      result      = &algorithm;
+      matchLength = tag.length();
+    }
+
+    const auto alias = compact(algorithm.sumsAlias);
+    if(!alias.isEmpty() && name.contains(alias) && alias.length() > matchLength)
+    {
+      result      = &algorithm;
+      matchLength = alias.length();
+    }
+  }
+
+  return result;
+}
@@ -0,0 +1,168 @@
+/*
+ File: Algorithms.h
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HASH_ALGORITHMS_H_
+#define HASH_ALGORITHMS_H_
+
+// Qt
+#include <QString>
+
+// C++
+#include <memory>
+
+class Hash;
+class MD5;
+class SHA1;
+class SHA224;
+class SHA256;
+class SHA384;
+class SHA512;
+class Tiger;
+class BLAKE3;
+class XXH3;
+class XXH128;
+class CRC32;
+class CRC32C;
+class BLAKE2b;
+class BLAKE2bp;
+class BLAKE2sp;
+class SHA3_256;
+class SHA3_384;
+class SHA3_512;
+class SHAKE128;
+class SHAKE256;
+class KangarooTwelve;
+class SHA512_256;
+class SHA512_224;
+
+/** \namespace Algorithms
+ * \brief Registry of the hash algorithms of the application. Adding an algorithm only
+ *        needs its class and a descriptor in the registry.
+ *
+ */
+namespace Algorithms
+{
+  /** \brief Identifiers of the algorithms, they are the indexes of their descriptors in the registry.
+   *
+   */
+  enum class Id: int
+  {
+    MD5 = 0, SHA1, SHA224, SHA256, SHA384, SHA512, TIGER, BLAKE3, XXH3, XXH128, CRC32, CRC32C, BLAKE2B,
+    BLAKE2BP, BLAKE2SP, SHA3_256, SHA3_384, SHA3_512, SHAKE128, SHAKE256, K12, SHA512_256, SHA512_224
+  };
+
+  /** \brief Returns a new hash object of the given class.
+   *
+   */
+  template<class T> std::shared_ptr<Hash> create();
+
+  /** \struct Descriptor
+   * \brief Properties of a hash algorithm.
+   *
+   */
+  struct Descriptor
+  {
+    Id                      id;           /** identifier of the algorithm.                                */
+    const char             *name;         /** name of the algorithm, the same as the one of its hashes.   */
+    const char             *description;  /** description of the algorithm and its digest size.           */
+    int                     digestLength; /** length of the digest in hexadecimal characters.             */
+    int                     blockSize;    /** size in bytes of the blocks that the hash processes.        */
+    const char             *sumsFilename; /** name of the file of the saved digests.                      */
+    const char             *sumsAlias;    /** another name of the files of other tools, or empty if none. */
+    const char             *settingsKey;  /** key of the enabled state in the settings.                   */
+    bool                    enabled;      /** true if the algorithm is selected by default.               */
+    std::shared_ptr<Hash> (*create)();    /** returns a new hash object of the algorithm.                 */
+  };
+
+  /** Descriptors of the algorithms, in the order they are shown. */
+  constexpr Descriptor REGISTRY[] =
+  {
+    { Id::MD5,        "MD5",         "Message-Digest Algorithm 5 (128 bits)",                             32,  64, "MD5SUMS.txt",        "", "MD5 Enabled",         false, create<MD5>            },
+    { Id::SHA1,       "SHA-1",       "Secure Hash Algorithm 1 (160 bits)",                                40,  64, "SHA1SUMS.txt",       "", "SHA-1 Enabled",       true,  create<SHA1>           },
+    { Id::SHA224,     "SHA-224",     "Secure Hash Algorithm 2 (224 bits)",                                56,  64, "SHA224SUMS.txt",     "", "SHA-224 Enabled",     false, create<SHA224>         },
+    { Id::SHA256,     "SHA-256",     "Secure Hash Algorithm 2 (256 bits)",                                64,  64, "SHA256SUMS.txt",     "", "SHA-256 Enabled",     false, create<SHA256>         },
+    { Id::SHA384,     "SHA-384",     "Secure Hash Algorithm 2 (384 bits)",                                96, 128, "SHA384SUMS.txt",     "", "SHA-384 Enabled",     false, create<SHA384>         },
+    { Id::SHA512,     "SHA-512",     "Secure Hash Algorithm 2 (512 bits)",                               128, 128, "SHA512SUMS.txt",     "", "SHA-512 Enabled",     false, create<SHA512>         },
+    { Id::TIGER,      "Tiger",       "Tiger (192 bits)",                                                  48,  64, "TIGERSUMS.txt",      "", "Tiger Enabled",       false, create<Tiger>          },
+    { Id::BLAKE3,     "BLAKE3",      "BLAKE3 (256 bits)",                                                 64,  64, "BLAKE3SUMS.txt",     "", "BLAKE3 Enabled",      false, create<BLAKE3>         },
+    { Id::XXH3,       "XXH3-64",     "XXH3 (64 bits)",                                                    16,  64, "XXH364SUMS.txt",     "", "XXH3-64 Enabled",     false, create<XXH3>           },
+    { Id::XXH128,     "XXH128",      "XXH3 (128 bits)",                                                   32,  64, "XXH128SUMS.txt",     "", "XXH128 Enabled",      false, create<XXH128>         },
+    { Id::CRC32,      "CRC32",       "Cyclic Redundancy Check IEEE 802.3 (32 bits)",                       8,  64, "CRC32.sfv",          "", "CRC32 Enabled",       false, create<CRC32>          },
+    { Id::CRC32C,     "CRC32C",      "Cyclic Redundancy Check Castagnoli (32 bits)",                       8,  64, "CRC32CSUMS.txt",     "", "CRC32C Enabled",      false, create<CRC32C>         },
+    { Id::BLAKE2B,    "BLAKE2b",     "BLAKE2b (512 bits)",                                               128, 128, "BLAKE2BSUMS.txt",    "B2SUM", "BLAKE2b Enabled", false, create<BLAKE2b>       },
+    { Id::BLAKE2BP,   "BLAKE2bp",    "BLAKE2bp, 4 parallel leaves (512 bits)",                           128, 512, "BLAKE2BPSUMS.txt",   "", "BLAKE2bp Enabled",    false, create<BLAKE2bp>       },
+    { Id::BLAKE2SP,   "BLAKE2sp",    "BLAKE2sp, 8 parallel leaves (256 bits)",                            64, 512, "BLAKE2SPSUMS.txt",   "", "BLAKE2sp Enabled",    false, create<BLAKE2sp>       },
+    { Id::SHA3_256,   "SHA3-256",    "Secure Hash Algorithm 3 (256 bits)",                                64, 136, "SHA3256SUMS.txt",    "", "SHA3-256 Enabled",    false, create<SHA3_256>       },
+    { Id::SHA3_384,   "SHA3-384",    "Secure Hash Algorithm 3 (384 bits)",                                96, 104, "SHA3384SUMS.txt",    "", "SHA3-384 Enabled",    false, create<SHA3_384>       },
+    { Id::SHA3_512,   "SHA3-512",    "Secure Hash Algorithm 3 (512 bits)",                               128,  72, "SHA3512SUMS.txt",    "", "SHA3-512 Enabled",    false, create<SHA3_512>       },
+    { Id::SHAKE128,   "SHAKE128",    "SHAKE128 extendable output function (256 bits)",                    64, 168, "SHAKE128SUMS.txt",   "", "SHAKE128 Enabled",    false, create<SHAKE128>       },
+    { Id::SHAKE256,   "SHAKE256",    "SHAKE256 extendable output function (512 bits)",                   128, 136, "SHAKE256SUMS.txt",   "", "SHAKE256 Enabled",    false, create<SHAKE256>       },
+    { Id::K12,        "K12",         "KangarooTwelve, Keccak tree hash with parallel leaves (256 bits)",  64, 168, "K12SUMS.txt",        "", "K12 Enabled",         false, create<KangarooTwelve> },
+    { Id::SHA512_256, "SHA-512/256", "Secure Hash Algorithm 2, truncated SHA-512 (256 bits)",             64, 128, "SHA512_256SUMS.txt", "", "SHA-512-256 Enabled", false, create<SHA512_256>     },
+    { Id::SHA512_224, "SHA-512/224", "Secure Hash Algorithm 2, truncated SHA-512 (224 bits)",             56, 128, "SHA512_224SUMS.txt", "", "SHA-512-224 Enabled", false, create<SHA512_224>     }
+  };
+
+  /** Number of algorithms. */
+  constexpr int COUNT = sizeof(REGISTRY) / sizeof(Descriptor);
+
+  /** \brief Returns true if the identifiers of the descriptors are their indexes.
+   *
+   */
+  constexpr bool isIndexed()
+  {
+    for(int i = 0; i < COUNT; ++i)
+    {
+      if(static_cast<int>(REGISTRY[i].id) != i) return false;
+    }
+
+    return true;
+  }
+
+  static_assert(isIndexed(), "The descriptors must be in the order of their identifiers.");
+
+  /** \brief Returns the descriptor of the given algorithm.
+   * \param[in] id algorithm identifier.
+   *
+   */
+  constexpr const Descriptor &descriptor(const Id id)
+  { return REGISTRY[static_cast<int>(id)]; }
+
+  /** \brief Returns the index of the given algorithm in the registry.
+   * \param[in] id algorithm identifier.
+   *
+   */
+  constexpr int index(const Id id)
+  { return static_cast<int>(id); }
+
+  /** \brief Returns the descriptor of the algorithm with the given name or nullptr if there is none.
+   * \param[in] name algorithm name.
+   *
+   */
+  const Descriptor *find(const QString &name);
+
+  /** \brief Returns the algorithm of the digests of the given SUMS file, told apart by the name of the
+   * file from the others with the same digest length, or nullptr if none has that length.
+   * \param[in] filename name of the SUMS file.
+   * \param[in] digestLength length of the digests in hexadecimal characters.
+   *
+   */
+  const Descriptor *fromSumsFile(const QString &filename, const int digestLength);
+}
+
+#endif // HASH_ALGORITHMS_H_
@@ -0,0 +1,420 @@
+/*
+ File: BLAKE2Kernels.cpp
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Project
+#include <hash/BLAKE2Kernels.h>
+#include <CPUFeatures.h>
+
+// C++
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define BLAKE2_SIMD_KERNELS
+#include <immintrin.h>
+#endif
+
+const std::uint64_t BLAKE2Kernels::IV64[8] =
+{
+  0x6A09E667F3BCC908ULL, 0xBB67AE8584CAA73BULL, 0x3C6EF372FE94F82BULL, 0xA54FF53A5F1D36F1ULL,
+  0x510E527FADE682D1ULL, 0x9B05688C2B3E6C1FULL, 0x1F83D9ABFB41BD6BULL, 0x5BE0CD19137E2179ULL
+};
+
+const std::uint32_t BLAKE2Kernels::IV32[8] =
+{
+  0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19
+};
+
+/** Message words permutation of each round, BLAKE2b repeats the first two in rounds 10 and 11. */
+static const std::uint8_t SIGMA[10][16] =
+{
+  {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 },
+  { 14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3 },
+  { 11,  8, 12,  0,  5,  2, 15, 13, 10, 14,  3,  6,  7,  1,  9,  4 },
+  {  7,  9,  3,  1, 13, 12, 11, 14,  2,  6,  5, 10,  4,  0, 15,  8 },
+  {  9,  0,  5,  7,  2,  4, 10, 15, 14,  1, 11, 12,  6,  8,  3, 13 },
+  {  2, 12,  6, 10,  0, 11,  8,  3,  4, 13,  7,  5, 15, 14,  1,  9 },
+  { 12,  5,  1, 15, 14, 13,  4, 10,  0,  7,  6,  3,  9,  2,  8, 11 },
+  { 13, 11,  7, 14, 12,  1,  3,  9,  5,  0, 15,  4,  8,  6,  2, 10 },
+  {  6, 15, 14,  9, 11,  3,  0,  8, 12,  2, 13,  7,  1,  4, 10,  5 },
+  { 10,  2,  8,  4,  7,  6,  1,  5, 15, 11,  9, 14,  3, 12, 13,  0 }
+};
+
+static const int ROUNDS64 = 12; /** number of rounds of BLAKE2b. */
+static const int ROUNDS32 = 10; /** number of rounds of BLAKE2s. */
+
+/** \brief Mixing function of the BLAKE2b state words.
+ * \param[inout] a b c d state words.
+ * \param[in] x y message words.
+ *
+ */
+static inline void g64(std::uint64_t &a, std::uint64_t &b, std::uint64_t &c, std::uint64_t &d, const std::uint64_t x, const std::uint64_t y)
+{
+  a = a + b + x;
+  d = d ^ a; d = (d >> 32) | (d << 32);
+  c = c + d;
+  b = b ^ c; b = (b >> 24) | (b << 40);
+  a = a + b + y;
+  d = d ^ a; d = (d >> 16) | (d << 48);
+  c = c + d;
+  b = b ^ c; b = (b >> 63) | (b << 1);
+}
+
+/** \brief Mixing function of the BLAKE2s state words.
+ * \param[inout] a b c d state words.
+ * \param[in] x y message words.
+ *
+ */
+static inline void g32(std::uint32_t &a, std::uint32_t &b, std::uint32_t &c, std::uint32_t &d, const std::uint32_t x, const std::uint32_t y)
+{
+  a = a + b + x;
+  d = d ^ a; d = (d >> 16) | (d << 16);
+  c = c + d;
+  b = b ^ c; b = (b >> 12) | (b << 20);
+  a = a + b + y;
+  d = d ^ a; d = (d >> 8) | (d << 24);
+  c = c + d;
+  b = b ^ c; b = (b >> 7) | (b << 25);
+}
+
+#ifdef BLAKE2_SIMD_KERNELS
+
+/** \brief Mixing function of four BLAKE2b states, one in each lane.
+ * \param[inout] a b c d state words.
+ * \param[in] x y message words.
+ *
+ */
+__attribute__((target("avx2")))
+static inline void g4x64(__m256i &a, __m256i &b, __m256i &c, __m256i &d, const __m256i x, const __m256i y)
+{
+  const auto rotate24 = _mm256_setr_epi8(3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10,
+                                         3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10);
+  const auto rotate16 = _mm256_setr_epi8(2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9,
+                                         2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9);
+
+  a = _mm256_add_epi64(_mm256_add_epi64(a, b), x);
+  d = _mm256_shuffle_epi32(_mm256_xor_si256(d, a), _MM_SHUFFLE(2, 3, 0, 1));
+  c = _mm256_add_epi64(c, d);
+  b = _mm256_shuffle_epi8(_mm256_xor_si256(b, c), rotate24);
+  a = _mm256_add_epi64(_mm256_add_epi64(a, b), y);
+  d = _mm256_shuffle_epi8(_mm256_xor_si256(d, a), rotate16);
+  c = _mm256_add_epi64(c, d);
+  b = _mm256_xor_si256(b, c);
+  b = _mm256_xor_si256(_mm256_srli_epi64(b, 63), _mm256_add_epi64(b, b));
+}
+
+/** \brief Mixing function of eight BLAKE2s states, one in each lane.
+ * \param[inout] a b c d state words.
+ * \param[in] x y message words.
+ *
+ */
+__attribute__((target("avx2")))
+static inline void g8x32(__m256i &a, __m256i &b, __m256i &c, __m256i &d, const __m256i x, const __m256i y)
+{
+  const auto rotate16 = _mm256_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+                                         2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+  const auto rotate8  = _mm256_setr_epi8(1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12,
+                                         1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12);
+
+  a = _mm256_add_epi32(_mm256_add_epi32(a, b), x);
+  d = _mm256_shuffle_epi8(_mm256_xor_si256(d, a), rotate16);
+  c = _mm256_add_epi32(c, d);
+  b = _mm256_xor_si256(b, c);
+  b = _mm256_or_si256(_mm256_srli_epi32(b, 12), _mm256_slli_epi32(b, 20));
+  a = _mm256_add_epi32(_mm256_add_epi32(a, b), y);
+  d = _mm256_shuffle_epi8(_mm256_xor_si256(d, a), rotate8);
+  c = _mm256_add_epi32(c, d);
+  b = _mm256_xor_si256(b, c);
+  b = _mm256_or_si256(_mm256_srli_epi32(b, 7), _mm256_slli_epi32(b, 25));
+}
+
+//----------------------------------------------------------------
+__attribute__((target("avx2")))
+static void compress4x64AVX2(std::uint64_t h[4][8], const unsigned char *data, const unsigned long long number, std::uint64_t counter)
+{
+  __m256i state[8];
+  for(int i = 0; i < 8; ++i)
+  {
+    state[i] = _mm256_setr_epi64x(h[0][i], h[1][i], h[2][i], h[3][i]);
+  }
+
+  for(unsigned long long block = 0; block < number; ++block, data += BLAKE2Kernels::SUPERBLOCK_SIZE)
+  {
+    counter += 128;
+
+    // transpose the 4x4 groups of words of the leaves.
+    __m256i m[16];
+    for(int i = 0; i < 4; ++i)
+    {
+      const auto r0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + 0 * 128 + 32 * i));
+      const auto r1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + 1 * 128 + 32 * i));
+      const auto r2 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + 2 * 128 + 32 * i));
+      const auto r3 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + 3 * 128 + 32 * i));
+
+      const auto t0 = _mm256_unpacklo_epi64(r0, r1);
+      const auto t1 = _mm256_unpackhi_epi64(r0, r1);
+      const auto t2 = _mm256_unpacklo_epi64(r2, r3);
+      const auto t3 = _mm256_unpackhi_epi64(r2, r3);
+
+      m[4 * i + 0] = _mm256_permute2x128_si256(t0, t2, 0x20);
+      m[4 * i + 1] = _mm256_permute2x128_si256(t1, t3, 0x20);
+      m[4 * i + 2] = _mm256_permute2x128_si256(t0, t2, 0x31);
+      m[4 * i + 3] = _mm256_permute2x128_si256(t1, t3, 0x31);
+    }
+
+    __m256i v[16];
+    for(int i = 0; i < 8; ++i)
+    {
+      v[i] = state[i];
+    }
+    for(int i = 0; i < 8; ++i)
+    {
+      v[i + 8] = _mm256_set1_epi64x(BLAKE2Kernels::IV64[i]);
+    }
+    v[12] = _mm256_xor_si256(v[12], _mm256_set1_epi64x(counter));
+
+    for(int round = 0; round < ROUNDS64; ++round)
+    {
+      const auto s = SIGMA[round % 10];
+      g4x64(v[0], v[4], v[ 8], v[12], m[s[ 0]], m[s[ 1]]);
+      g4x64(v[1], v[5], v[ 9], v[13], m[s[ 2]], m[s[ 3]]);
+      g4x64(v[2], v[6], v[10], v[14], m[s[ 4]], m[s[ 5]]);
+      g4x64(v[3], v[7], v[11], v[15], m[s[ 6]], m[s[ 7]]);
+      g4x64(v[0], v[5], v[10], v[15], m[s[ 8]], m[s[ 9]]);
+      g4x64(v[1], v[6], v[11], v[12], m[s[10]], m[s[11]]);
+      g4x64(v[2], v[7], v[ 8], v[13], m[s[12]], m[s[13]]);
+      g4x64(v[3], v[4], v[ 9], v[14], m[s[14]], m[s[15]]);
+    }
+
+    for(int i = 0; i < 8; ++i)
+    {
+      state[i] = _mm256_xor_si256(state[i], _mm256_xor_si256(v[i], v[i + 8]));
+    }
+  }
+
+  alignas(32) std::uint64_t words[4];
+  for(int i = 0; i < 8; ++i)
+  {
+    _mm256_store_si256(reinterpret_cast<__m256i *>(words), state[i]);
+    for(int leaf = 0; leaf < 4; ++leaf) h[leaf][i] = words[leaf];
+  }
+}
+
+//----------------------------------------------------------------
+__attribute__((target("avx2")))
+static void compress8x32AVX2(std::uint32_t h[8][8], const unsigned char *data, const unsigned long long number, std::uint64_t counter)
+{
+  __m256i state[8];
+  for(int i = 0; i < 8; ++i)
+  {
+    state[i] = _mm256_setr_epi32(h[0][i], h[1][i], h[2][i], h[3][i], h[4][i], h[5][i], h[6][i], h[7][i]);
+  }
+
+  for(unsigned long long block = 0; block < number; ++block, data += BLAKE2Kernels::SUPERBLOCK_SIZE)
+  {
+    counter += 64;
+
+    // transpose the 8x8 groups of words of the leaves.
+    __m256i m[16];
+    for(int i = 0; i < 2; ++i)
+    {
+      __m256i r[8];
+      for(int leaf = 0; leaf < 8; ++leaf)
+      {
+        r[leaf] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + leaf * 64 + 32 * i));
+      }
+
+      const auto t0 = _mm256_unpacklo_epi32(r[0], r[1]);
+      const auto t1 = _mm256_unpackhi_epi32(r[0], r[1]);
+      const auto t2 = _mm256_unpacklo_epi32(r[2], r[3]);
+      const auto t3 = _mm256_unpackhi_epi32(r[2], r[3]);
+      const auto t4 = _mm256_unpacklo_epi32(r[4], r[5]);
+      const auto t5 = _mm256_unpackhi_epi32(r[4], r[5]);
+      const auto t6 = _mm256_unpacklo_epi32(r[6], r[7]);
+      const auto t7 = _mm256_unpackhi_epi32(r[6], r[7]);
+
+      const auto u0 = _mm256_unpacklo_epi64(t0, t2);
+      const auto u1 = _mm256_unpackhi_epi64(t0, t2);
+      const auto u2 = _mm256_unpacklo_epi64(t1, t3);
+      const auto u3 = _mm256_unpackhi_epi64(t1, t3);
+      const auto u4 = _mm256_unpacklo_epi64(t4, t6);
+      const auto u5 = _mm256_unpackhi_epi64(t4, t6);
+      const auto u6 = _mm256_unpacklo_epi64(t5, t7);
+      const auto u7 = _mm256_unpackhi_epi64(t5, t7);
+
+      m[8 * i + 0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+      m[8 * i + 1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+      m[8 * i + 2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+      m[8 * i + 3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+      m[8 * i + 4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+      m[8 * i + 5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+      m[8 * i + 6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+      m[8 * i + 7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+    }
+
+    __m256i v[16];
+    for(int i = 0; i < 8; ++i)
+    {
+      v[i] = state[i];
+    }
+    for(int i = 0; i < 8; ++i)
+    {
+      v[i + 8] = _mm256_set1_epi32(BLAKE2Kernels::IV32[i]);
+    }
+    v[12] = _mm256_xor_si256(v[12], _mm256_set1_epi32(static_cast<std::uint32_t>(counter)));
+    v[13] = _mm256_xor_si256(v[13], _mm256_set1_epi32(static_cast<std::uint32_t>(counter >> 32)));
+
+    for(int round = 0; round < ROUNDS32; ++round)
+    {
+      const auto s = SIGMA[round % 10];
+      g8x32(v[0], v[4], v[ 8], v[12], m[s[ 0]], m[s[ 1]]);
+      g8x32(v[1], v[5], v[ 9], v[13], m[s[ 2]], m[s[ 3]]);
+      g8x32(v[2], v[6], v[10], v[14], m[s[ 4]], m[s[ 5]]);
+      g8x32(v[3], v[7], v[11], v[15], m[s[ 6]], m[s[ 7]]);
+      g8x32(v[0], v[5], v[10], v[15], m[s[ 8]], m[s[ 9]]);
+      g8x32(v[1], v[6], v[11], v[12], m[s[10]], m[s[11]]);
+      g8x32(v[2], v[7], v[ 8], v[13], m[s[12]], m[s[13]]);
+      g8x32(v[3], v[4], v[ 9], v[14], m[s[14]], m[s[15]]);
+    }
+
+    for(int i = 0; i < 8; ++i)
+    {
+      state[i] = _mm256_xor_si256(state[i], _mm256_xor_si256(v[i], v[i + 8]));
+    }
+  }
+
+  alignas(32) std::uint32_t words[8];
+  for(int i = 0; i < 8; ++i)
+  {
+    _mm256_store_si256(reinterpret_cast<__m256i *>(words), state[i]);
+    for(int leaf = 0; leaf < 8; ++leaf) h[leaf][i] = words[leaf];
+  }
+}
+
+#endif // BLAKE2_SIMD_KERNELS
+
+//----------------------------------------------------------------
+void BLAKE2Kernels::compress64(std::uint64_t h[8], const unsigned char block[128], const std::uint64_t counter, const bool last, const bool lastNode)
+{
+  std::uint64_t m[16];
+  std::memcpy(m, block, sizeof(m));
+
+  std::uint64_t v[16] =
+  {
+    h[0], h[1], h[2], h[3], h[4], h[5], h[6], h[7],
+    IV64[0], IV64[1], IV64[2], IV64[3],
+    IV64[4] ^ counter, IV64[5], last ? ~IV64[6] : IV64[6], lastNode ? ~IV64[7] : IV64[7]
+  };
+
+  for(int round = 0; round < ROUNDS64; ++round)
+  {
+    const auto s = SIGMA[round % 10];
+    g64(v[0], v[4], v[ 8], v[12], m[s[ 0]], m[s[ 1]]);
+    g64(v[1], v[5], v[ 9], v[13], m[s[ 2]], m[s[ 3]]);
+    g64(v[2], v[6], v[10], v[14], m[s[ 4]], m[s[ 5]]);
+    g64(v[3], v[7], v[11], v[15], m[s[ 6]], m[s[ 7]]);
+    g64(v[0], v[5], v[10], v[15], m[s[ 8]], m[s[ 9]]);
+    g64(v[1], v[6], v[11], v[12], m[s[10]], m[s[11]]);
+    g64(v[2], v[7], v[ 8], v[13], m[s[12]], m[s[13]]);
+    g64(v[3], v[4], v[ 9], v[14], m[s[14]], m[s[15]]);
+  }
+
+  for(int i = 0; i < 8; ++i)
+  {
+    h[i] ^= v[i] ^ v[i + 8];
+  }
+}
+
+//----------------------------------------------------------------
+void BLAKE2Kernels::compress32(std::uint32_t h[8], const unsigned char block[64], const std::uint64_t counter, const bool last, const bool lastNode)
+{
+  std::uint32_t m[16];
+  std::memcpy(m, block, sizeof(m));
+
+  std::uint32_t v[16] =
+  {
+    h[0], h[1], h[2], h[3], h[4], h[5], h[6], h[7],
+    IV32[0], IV32[1], IV32[2], IV32[3],
+    IV32[4] ^ static_cast<std::uint32_t>(counter), IV32[5] ^ static_cast<std::uint32_t>(counter >> 32),
+    last ? ~IV32[6] : IV32[6], lastNode ? ~IV32[7] : IV32[7]
+  };
+
+  for(int round = 0; round < ROUNDS32; ++round)
+  {
+    const auto s = SIGMA[round];
+    g32(v[0], v[4], v[ 8], v[12], m[s[ 0]], m[s[ 1]]);
+    g32(v[1], v[5], v[ 9], v[13], m[s[ 2]], m[s[ 3]]);
+    g32(v[2], v[6], v[10], v[14], m[s[ 4]], m[s[ 5]]);
+    g32(v[3], v[7], v[11], v[15], m[s[ 6]], m[s[ 7]]);
+    g32(v[0], v[5], v[10], v[15], m[s[ 8]], m[s[ 9]]);
+    g32(v[1], v[6], v[11], v[12], m[s[10]], m[s[11]]);
+    g32(v[2], v[7], v[ 8], v[13], m[s[12]], m[s[13]]);
+    g32(v[3], v[4], v[ 9], v[14], m[s[14]], m[s[15]]);
+  }
+
+  for(int i = 0; i < 8; ++i)
+  {
+    h[i] ^= v[i] ^ v[i + 8];
+  }
+}
+
+//----------------------------------------------------------------
+void BLAKE2Kernels::compress4x64(std::uint64_t h[4][8], const unsigned char *data, const unsigned long long number, std::uint64_t counter)
+{
+#ifdef BLAKE2_SIMD_KERNELS
+  static const bool useAVX2 = CPUFeatures::hasAVX2();
+
+  if(useAVX2)
+  {
+    compress4x64AVX2(h, data, number, counter);
+    return;
+  }
+#endif
+
+  for(unsigned long long block = 0; block < number; ++block, data += SUPERBLOCK_SIZE)
+  {
+    counter += 128;
+    for(int leaf = 0; leaf < 4; ++leaf)
+    {
+      compress64(h[leaf], data + leaf * 128, counter, false, false);
+    }
+  }
+}
+
+//----------------------------------------------------------------
+void BLAKE2Kernels::compress8x32(std::uint32_t h[8][8], const unsigned char *data, const unsigned long long number, std::uint64_t counter)
+{
+#ifdef BLAKE2_SIMD_KERNELS
+  static const bool useAVX2 = CPUFeatures::hasAVX2();
+
+  if(useAVX2)
+  {
+    compress8x32AVX2(h, data, number, counter);
+    return;
+  }
+#endif
+
+  for(unsigned long long block = 0; block < number; ++block, data += SUPERBLOCK_SIZE)
+  {
+    counter += 64;
+    for(int leaf = 0; leaf < 8; ++leaf)
+    {
+      compress32(h[leaf], data + leaf * 64, counter, false, false);
+    }
+  }
+}
@@ -0,0 +1,78 @@
+/*
+ File: BLAKE2Kernels.h
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HASH_BLAKE2KERNELS_H_
+#define HASH_BLAKE2KERNELS_H_
+
+// C++
+#include <cstdint>
+
+/** BLAKE2b and BLAKE2s compression functions, the SIMD versions compress the blocks of the
+ *  leaves of the parallel variants at the same time, one leaf in each lane. */
+namespace BLAKE2Kernels
+{
+  /** Initialization vector of BLAKE2b, the same as SHA-512. */
+  extern const std::uint64_t IV64[8];
+
+  /** Initialization vector of BLAKE2s, the same as SHA-256. */
+  extern const std::uint32_t IV32[8];
+
+  /** Size in bytes of the group of blocks of the parallel variants, one block for each leaf. */
+  const int SUPERBLOCK_SIZE = 512;
+
+  /** \brief Compresses one BLAKE2b block in place.
+   * \param[inout] h chaining value.
+   * \param[in] block block data, padded with zeroes.
+   * \param[in] counter number of bytes hashed including the block.
+   * \param[in] last true if it's the last block.
+   * \param[in] lastNode true if it's the last block of the last node of a tree level.
+   *
+   */
+  void compress64(std::uint64_t h[8], const unsigned char block[128], const std::uint64_t counter, const bool last, const bool lastNode);
+
+  /** \brief Compresses one BLAKE2s block in place.
+   * \param[inout] h chaining value.
+   * \param[in] block block data, padded with zeroes.
+   * \param[in] counter number of bytes hashed including the block.
+   * \param[in] last true if it's the last block.
+   * \param[in] lastNode true if it's the last block of the last node of a tree level.
+   *
+   */
+  void compress32(std::uint32_t h[8], const unsigned char block[64], const std::uint64_t counter, const bool last, const bool lastNode);
+
+  /** \brief Compresses the interleaved blocks of four BLAKE2b leaves, none of them is the last block.
+   * \param[inout] h chaining values of the leaves.
+   * \param[in] data data buffer, the blocks of the leaves in order.
+   * \param[in] number number of groups of 512 bytes in the buffer.
+   * \param[in] counter number of bytes hashed by each leaf before the data.
+   *
+   */
+  void compress4x64(std::uint64_t h[4][8], const unsigned char *data, const unsigned long long number, const std::uint64_t counter);
+
+  /** \brief Compresses the interleaved blocks of eight BLAKE2s leaves, none of them is the last block.
+   * \param[inout] h chaining values of the leaves.
+   * \param[in] data data buffer, the blocks of the leaves in order.
+   * \param[in] number number of groups of 512 bytes in the buffer.
+   * \param[in] counter number of bytes hashed by each leaf before the data.
+   *
+   */
+  void compress8x32(std::uint32_t h[8][8], const unsigned char *data, const unsigned long long number, const std::uint64_t counter);
+}
+
+#endif // HASH_BLAKE2KERNELS_H_
@@ -0,0 +1,92 @@
+/*
+ File: BLAKE2Tree.cpp
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Project
+#include <hash/BLAKE2Tree.h>
+
+// C++
+#include <algorithm>
+#include <cstring>
+
+//----------------------------------------------------------------
+BLAKE2Tree::BLAKE2Tree()
+: Hash        {}
+, m_tailLength{0}
+{
+}
+
+//----------------------------------------------------------------
+void BLAKE2Tree::reset()
+{
+  Hash::reset();
+
+  m_tailLength = 0;
+}
+
+//----------------------------------------------------------------
+void BLAKE2Tree::update(const unsigned char *data, const unsigned long long length)
+{
+  const unsigned long long size = BLAKE2Kernels::SUPERBLOCK_SIZE;
+  auto remaining = length;
+
+  m_messageLength += length;
+
+  if(m_tailLength + remaining <= TAIL_SIZE)
+  {
+    std::memcpy(m_tail + m_tailLength, data, remaining);
+    m_tailLength += remaining;
+    return;
+  }
+
+  if(m_tailLength != 0)
+  {
+    // complete the group of the tail and process the groups followed by enough data.
+    const auto bytes = std::min((size - (m_tailLength % size)) % size, remaining);
+    std::memcpy(m_tail + m_tailLength, data, bytes);
+    m_tailLength += bytes;
+    data += bytes;
+    remaining -= bytes;
+
+    while(m_tailLength >= static_cast<int>(size) && (m_tailLength - size + remaining) > size)
+    {
+      process_blocks(m_tail, 1);
+      m_tailLength -= size;
+      std::memmove(m_tail, m_tail + size, m_tailLength);
+    }
+
+    if(m_tailLength != 0)
+    {
+      std::memcpy(m_tail + m_tailLength, data, remaining);
+      m_tailLength += remaining;
+      return;
+    }
+  }
+
+  // keep more than a group in the tail.
+  const auto groups = (remaining - size - 1) / size;
+  if(groups != 0)
+  {
+    process_blocks(data, groups);
+    data += groups * size;
+    remaining -= groups * size;
+  }
+
+  std::memcpy(m_tail, data, remaining);
+  m_tailLength = remaining;
+}
@@ -0,0 +1,62 @@
+/*
+ File: BLAKE2Tree.h
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HASH_BLAKE2TREE_H_
+#define HASH_BLAKE2TREE_H_
+
+// Project
+#include <Hash.h>
+#include <hash/BLAKE2Kernels.h>
+
+/** \class BLAKE2Tree
+ * \brief Base class of the parallel BLAKE2 variants. The message is divided in groups of 512
+ *        bytes with one block for each leaf, the groups are processed only when more than 512
+ *        bytes follow them so every leaf still has its last block in the tail at the finalization.
+ *
+ */
+class BLAKE2Tree
+: public Hash
+{
+  public:
+    /** \brief BLAKE2Tree class virtual destructor.
+     *
+     */
+    virtual ~BLAKE2Tree()
+    {};
+
+    virtual const int blockSize() const override
+    { return BLAKE2Kernels::SUPERBLOCK_SIZE; }
+
+    virtual void reset() override;
+
+    virtual void update(const unsigned char *data, const unsigned long long length) override;
+
+  protected:
+    /** \brief BLAKE2Tree class constructor.
+     *
+     */
+    BLAKE2Tree();
+
+    static const int TAIL_SIZE = 2 * BLAKE2Kernels::SUPERBLOCK_SIZE; /** maximum size of the data not processed. */
+
+    unsigned char m_tail[TAIL_SIZE]; /** data not processed yet, at most two groups of blocks. */
+    int           m_tailLength;      /** length of the data in the tail.                       */
+};
+
+#endif // HASH_BLAKE2TREE_H_
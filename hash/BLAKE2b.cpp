@@ -0,0 +1,122 @@
+/*
+ File: BLAKE2b.cpp
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Project
+#include <hash/BLAKE2b.h>
+#include <hash/BLAKE2Kernels.h>
+
+// Qt
+#include <QStringList>
+
+// C++
+#include <cstring>
+
+//----------------------------------------------------------------
+BLAKE2b::BLAKE2b()
+: Hash{}
+{
+  reset();
+}
+
+//----------------------------------------------------------------
+const QString BLAKE2b::value() const
+{
+  QStringList words;
+  for(int i = 0; i < 16; ++i)
+  {
+    words << QString::fromLatin1(QByteArray(reinterpret_cast<const char *>(m_hash + 4 * i), 4).toHex());
+  }
+
+  return words.join(' ');
+}
+
+//----------------------------------------------------------------
+void BLAKE2b::reset()
+{
+  Hash::reset();
+
+  std::memcpy(m_state, BLAKE2Kernels::IV64, sizeof(m_state));
+
+  // parameter block: digest length of 64 bytes, no key, fanout 1 and depth 1.
+  m_state[0] ^= 0x01010040;
+
+  m_counter = 0;
+  std::memset(m_hash, 0, sizeof(m_hash));
+}
+
+//----------------------------------------------------------------
+void BLAKE2b::update(const unsigned char *data, const unsigned long long length)
+{
+  const unsigned long long size = blockSize();
+  auto remaining = length;
+
+  m_messageLength += length;
+
+  if(m_bufferLength + remaining <= size)
+  {
+    std::memcpy(m_buffer + m_bufferLength, data, remaining);
+    m_bufferLength += remaining;
+    return;
+  }
+
+  // there is more data, so the buffered block isn't the last one.
+  if(m_bufferLength != 0)
+  {
+    const auto bytes = size - m_bufferLength;
+    std::memcpy(m_buffer + m_bufferLength, data, bytes);
+    data += bytes;
+    remaining -= bytes;
+
+    process_blocks(m_buffer, 1);
+    m_bufferLength = 0;
+  }
+
+  // keep at least one byte for the last block.
+  const auto blocks = (remaining - 1) / size;
+  if(blocks != 0)
+  {
+    process_blocks(data, blocks);
+    data += blocks * size;
+    remaining -= blocks * size;
+  }
+
+  std::memcpy(m_buffer, data, remaining);
+  m_bufferLength = remaining;
+}
+
+//----------------------------------------------------------------
+void BLAKE2b::finalize()
+{
+  std::memset(m_buffer + m_bufferLength, 0, blockSize() - m_bufferLength);
+  m_counter += m_bufferLength;
+
+  BLAKE2Kernels::compress64(m_state, m_buffer, m_counter, true, false);
+
+  std::memcpy(m_hash, m_state, sizeof(m_hash));
+}
+
+//----------------------------------------------------------------
+void BLAKE2b::process_blocks(const unsigned char *blocks, const unsigned long long number)
+{
+  for(unsigned long long i = 0; i < number; ++i)
+  {
+    m_counter += 128;
+    BLAKE2Kernels::compress64(m_state, blocks + i * 128, m_counter, false, false);
+  }
+}
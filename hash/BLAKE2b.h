@@ -0,0 +1,74 @@
+/*
+ File: BLAKE2b.h
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HASH_BLAKE2B_H_
+#define HASH_BLAKE2B_H_
+
+// Project
+#include <Hash.h>
+
+// C++
+#include <cstdint>
+
+/** \class BLAKE2b
+ * \brief Implements the BLAKE2b hash of 512 bits, the default of the b2sum tool. The last block
+ *        is flagged, so the last complete block is kept in the buffer until more data arrives.
+ *
+ */
+class BLAKE2b
+: public Hash
+{
+  public:
+    /** \brief BLAKE2b class constructor.
+     *
+     */
+    BLAKE2b();
+
+    /** \brief BLAKE2b class virtual destructor.
+     *
+     */
+    virtual ~BLAKE2b()
+    {};
+
+    virtual const int blockSize() const override
+    { return 128; }
+
+    virtual const QString value() const override;
+
+    virtual const QString name() const override
+    { return QString("BLAKE2b"); }
+
+    virtual Algorithms::Id algorithm() const override
+    { return Algorithms::Id::BLAKE2B; }
+
+    virtual void reset() override;
+
+    virtual void update(const unsigned char *data, const unsigned long long length) override;
+
+    virtual void finalize() override;
+
+  private:
+    virtual void process_blocks(const unsigned char *blocks, const unsigned long long number) override;
+
+    std::uint64_t m_state[8];   /** chaining value.                               */
+    std::uint64_t m_counter;    /** number of bytes compressed.                   */
+    unsigned char m_hash[64];   /** hash value.                                   */
+};
+
+#endif // HASH_BLAKE2B_H_
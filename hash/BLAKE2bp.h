@@ -0,0 +1,72 @@
+/*
+ File: BLAKE2bp.h
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HASH_BLAKE2BP_H_
+#define HASH_BLAKE2BP_H_
+
+// Project
+#include <hash/BLAKE2Tree.h>
+
+// C++
+#include <cstdint>
+
+/** \class BLAKE2bp
+ * \brief Implements the BLAKE2bp hash of 512 bits. The blocks of 128 bytes are distributed
+ *        between four BLAKE2b leaves that are compressed at the same time, one in each SIMD
+ *        lane, and the root hashes the four leaf values.
+ *
+ */
+class BLAKE2bp
+: public BLAKE2Tree
+{
+  public:
+    /** \brief BLAKE2bp class constructor.
+     *
+     */
+    BLAKE2bp();
+
+    /** \brief BLAKE2bp class virtual destructor.
+     *
+     */
+    virtual ~BLAKE2bp()
+    {};
+
+    virtual const QString value() const override;
+
+    virtual const QString name() const override
+    { return QString("BLAKE2bp"); }
+
+    virtual Algorithms::Id algorithm() const override
+    { return Algorithms::Id::BLAKE2BP; }
+
+    virtual void reset() override;
+
+    virtual void finalize() override;
+
+  private:
+    virtual void process_blocks(const unsigned char *blocks, const unsigned long long number) override;
+
+    static const int LEAVES = 4; /** number of leaves. */
+
+    std::uint64_t m_leaves[LEAVES][8]; /** chaining values of the leaves.                 */
+    std::uint64_t m_counter;           /** number of bytes compressed by each leaf.       */
+    unsigned char m_hash[64];          /** hash value.                                    */
+};
+
+#endif // HASH_BLAKE2BP_H_
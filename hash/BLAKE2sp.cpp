@@ -0,0 +1,120 @@
+/*
+ File: BLAKE2sp.cpp
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Project
+#include <hash/BLAKE2sp.h>
+
+// Qt
+#include <QStringList>
+
+// C++
+#include <algorithm>
+#include <cstring>
+
+//----------------------------------------------------------------
+BLAKE2sp::BLAKE2sp()
+: BLAKE2Tree{}
+{
+  reset();
+}
+
+//----------------------------------------------------------------
+const QString BLAKE2sp::value() const
+{
+  QStringList words;
+  for(int i = 0; i < 8; ++i)
+  {
+    words << QString::fromLatin1(QByteArray(reinterpret_cast<const char *>(m_hash + 4 * i), 4).toHex());
+  }
+
+  return words.join(' ');
+}
+
+//----------------------------------------------------------------
+void BLAKE2sp::reset()
+{
+  BLAKE2Tree::reset();
+
+  // parameter block: digest length of 32 bytes, fanout 8, depth 2, leaf offset and inner length of 32 bytes.
+  for(int leaf = 0; leaf < LEAVES; ++leaf)
+  {
+    std::memcpy(m_leaves[leaf], BLAKE2Kernels::IV32, sizeof(m_leaves[leaf]));
+    m_leaves[leaf][0] ^= 0x02080020;
+    m_leaves[leaf][2] ^= leaf;
+    m_leaves[leaf][3] ^= 0x20000000;
+  }
+
+  m_counter = 0;
+  std::memset(m_hash, 0, sizeof(m_hash));
+}
+
+//----------------------------------------------------------------
+void BLAKE2sp::finalize()
+{
+  unsigned char block[64];
+  unsigned char values[LEAVES * 32];
+
+  // the last block of each leaf is in the tail, if the leaf has data.
+  for(int leaf = 0; leaf < LEAVES; ++leaf)
+  {
+    auto counter = m_counter;
+    const auto isLastLeaf = (leaf == LEAVES - 1);
+
+    auto offset = leaf * 64;
+    if(offset >= m_tailLength)
+    {
+      std::memset(block, 0, sizeof(block));
+      BLAKE2Kernels::compress32(m_leaves[leaf], block, counter, true, isLastLeaf);
+    }
+
+    for(; offset < m_tailLength; offset += BLAKE2Kernels::SUPERBLOCK_SIZE)
+    {
+      const auto length = std::min(64, m_tailLength - offset);
+      const auto isLast = (offset + BLAKE2Kernels::SUPERBLOCK_SIZE >= m_tailLength);
+
+      std::memset(block, 0, sizeof(block));
+      std::memcpy(block, m_tail + offset, length);
+      counter += length;
+
+      BLAKE2Kernels::compress32(m_leaves[leaf], block, counter, isLast, isLast && isLastLeaf);
+    }
+
+    std::memcpy(values + leaf * 32, m_leaves[leaf], 32);
+  }
+
+  // parameter block: digest length of 32 bytes, fanout 8, depth 2, node depth 1 and inner length of 32 bytes.
+  std::uint32_t root[8];
+  std::memcpy(root, BLAKE2Kernels::IV32, sizeof(root));
+  root[0] ^= 0x02080020;
+  root[3] ^= 0x20010000;
+
+  for(int i = 0; i < 4; ++i)
+  {
+    BLAKE2Kernels::compress32(root, values + 64 * i, 64 * (i + 1), i == 3, i == 3);
+  }
+
+  std::memcpy(m_hash, root, sizeof(m_hash));
+}
+
+//----------------------------------------------------------------
+void BLAKE2sp::process_blocks(const unsigned char *blocks, const unsigned long long number)
+{
+  BLAKE2Kernels::compress8x32(m_leaves, blocks, number, m_counter);
+  m_counter += number * 64;
+}
@@ -0,0 +1,367 @@
+/*
+ File: BLAKE3.cpp
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Project
+#include <hash/BLAKE3.h>
+#include <hash/BLAKE3Kernels.h>
+
+// Qt
+#include <QThreadPool>
+#include <QSemaphore>
+
+// C++
+#include <algorithm>
+#include <cstring>
+
+using namespace BLAKE3Kernels;
+
+/** Length of the chunks, the leaves of the tree. */
+static const unsigned long long CHUNK_LENGTH = 1024;
+
+/** Minimum length of the subtrees hashed by the threads of the pool. */
+static const unsigned long long PARALLEL_SUBTREE_LENGTH = 128 * 1024;
+
+/** \brief Returns the largest power of two less than or equal to the given value.
+ * \param[in] value value greater than zero.
+ *
+ */
+static unsigned long long roundDownToPowerOfTwo(const unsigned long long value)
+{
+  return 1ULL << (63 - __builtin_clzll(value));
+}
+
+/** \brief Returns the length of the left subtree of a node, the largest power of two number
+ * of chunks that leaves at least one byte for the right subtree.
+ * \param[in] length length of the node data in bytes.
+ *
+ */
+static unsigned long long leftSubtreeLength(const unsigned long long length)
+{
+  const auto chunks = (length - 1) / CHUNK_LENGTH;
+  return roundDownToPowerOfTwo(chunks) * CHUNK_LENGTH;
+}
+
+//----------------------------------------------------------------
+void BLAKE3::Output::chainingValue(std::uint32_t result[8]) const
+{
+  std::memcpy(result, cv, sizeof(cv));
+  compress(result, block, length, counter, flags);
+}
+
+//----------------------------------------------------------------
+BLAKE3::BLAKE3()
+: Hash  {}
+, m_pool{nullptr}
+{
+  reset();
+}
+
+//----------------------------------------------------------------
+const QString BLAKE3::value() const
+{
+  QStringList words;
+  for(int i = 0; i < 8; ++i)
+  {
+    words << QString::fromLatin1(QByteArray(reinterpret_cast<const char *>(m_hash + 4 * i), 4).toHex());
+  }
+
+  return words.join(' ');
+}
+
+//----------------------------------------------------------------
+void BLAKE3::reset()
+{
+  Hash::reset();
+
+  std::memcpy(m_chunkCV, IV, sizeof(m_chunkCV));
+  m_chunkCounter     = 0;
+  m_blocksCompressed = 0;
+  m_stackLength      = 0;
+  std::memset(m_hash, 0, sizeof(m_hash));
+}
+
+//----------------------------------------------------------------
+void BLAKE3::update(const unsigned char *data, unsigned long long length)
+{
+  m_messageLength += length;
+
+  // the current chunk is completed first, it's compressed when more data arrives as it could be the root.
+  if(chunkLength() > 0)
+  {
+    const auto bytes = std::min(CHUNK_LENGTH - chunkLength(), length);
+    chunkUpdate(data, bytes);
+    data += bytes;
+    length -= bytes;
+
+    if(length == 0) return;
+
+    std::uint32_t cv[8];
+    chunkOutput().chainingValue(cv);
+    pushChainingValue(cv, m_chunkCounter);
+
+    std::memcpy(m_chunkCV, IV, sizeof(m_chunkCV));
+    ++m_chunkCounter;
+    m_blocksCompressed = 0;
+    m_bufferLength     = 0;
+  }
+
+  // hash the largest subtrees aligned with the chunk counter. The chaining values of both children
+  // are kept in the stack so the root can be computed if it's the last subtree.
+  while(length > CHUNK_LENGTH)
+  {
+    auto subtreeLength = roundDownToPowerOfTwo(length);
+    while(((subtreeLength - 1) & (m_chunkCounter * CHUNK_LENGTH)) != 0)
+    {
+      subtreeLength /= 2;
+    }
+
+    const auto subtreeChunks = subtreeLength / CHUNK_LENGTH;
+
+    if(subtreeChunks == 1)
+    {
+      std::uint32_t cv[8];
+      hashMany(data, CHUNK_LENGTH, 1, CHUNK_LENGTH / 64, IV, m_chunkCounter, true, 0, CHUNK_START, CHUNK_END, cv);
+      pushChainingValue(cv, m_chunkCounter);
+    }
+    else
+    {
+      std::uint32_t cvs[16];
+      hashSubtree(data, subtreeLength, m_chunkCounter, cvs);
+      pushChainingValue(cvs, m_chunkCounter);
+      pushChainingValue(cvs + 8, m_chunkCounter + subtreeChunks / 2);
+    }
+
+    m_chunkCounter += subtreeChunks;
+    data += subtreeLength;
+    length -= subtreeLength;
+  }
+
+  // the remaining data is less than a chunk.
+  if(length > 0)
+  {
+    chunkUpdate(data, length);
+    mergeStack(m_chunkCounter);
+  }
+}
+
+//----------------------------------------------------------------
+void BLAKE3::finalize()
+{
+  Output output;
+
+  if(m_stackLength == 0)
+  {
+    output = chunkOutput();
+  }
+  else
+  {
+    // the stack has been merged, only the nodes of the right edge of the tree are left.
+    int remaining = m_stackLength;
+    if(chunkLength() > 0)
+    {
+      output = chunkOutput();
+    }
+    else
+    {
+      remaining -= 2;
+      output = parentOutput(m_stack[remaining], m_stack[remaining + 1]);
+    }
+
+    while(remaining > 0)
+    {
+      --remaining;
+
+      std::uint32_t cv[8];
+      output.chainingValue(cv);
+      output = parentOutput(m_stack[remaining], cv);
+    }
+  }
+
+  std::uint32_t root[8];
+  std::memcpy(root, output.cv, sizeof(root));
+  compress(root, output.block, output.length, 0, output.flags | ROOT);
+  std::memcpy(m_hash, root, sizeof(m_hash));
+}
+
+//----------------------------------------------------------------
+void BLAKE3::process_blocks(const unsigned char *blocks, const unsigned long long number)
+{
+  for(unsigned long long i = 0; i < number; ++i, ++m_blocksCompressed)
+  {
+    compress(m_chunkCV, blocks + (i * 64), 64, m_chunkCounter, m_blocksCompressed == 0 ? CHUNK_START : 0);
+  }
+}
+
+//----------------------------------------------------------------
+void BLAKE3::chunkUpdate(const unsigned char *data, unsigned long long length)
+{
+  if(m_bufferLength != 0)
+  {
+    const auto bytes = std::min(64ULL - m_bufferLength, length);
+    std::memcpy(m_buffer + m_bufferLength, data, bytes);
+    m_bufferLength += bytes;
+    data += bytes;
+    length -= bytes;
+
+    if(length == 0) return;
+
+    process_blocks(m_buffer, 1);
+    m_bufferLength = 0;
+  }
+
+  // the last block is always buffered.
+  if(length > 64)
+  {
+    const auto blocks = (length - 1) / 64;
+    process_blocks(data, blocks);
+    data += blocks * 64;
+    length -= blocks * 64;
+  }
+
+  std::memcpy(m_buffer, data, length);
+  m_bufferLength = length;
+}
+
+//----------------------------------------------------------------
+unsigned long long BLAKE3::chunkLength() const
+{
+  return m_blocksCompressed * 64ULL + m_bufferLength;
+}
+
+//----------------------------------------------------------------
+BLAKE3::Output BLAKE3::chunkOutput() const
+{
+  Output output;
+  std::memcpy(output.cv, m_chunkCV, sizeof(output.cv));
+  std::memset(output.block, 0, sizeof(output.block));
+  std::memcpy(output.block, m_buffer, m_bufferLength);
+  output.length  = m_bufferLength;
+  output.counter = m_chunkCounter;
+  output.flags   = (m_blocksCompressed == 0 ? CHUNK_START : 0) | CHUNK_END;
+
+  return output;
+}
+
+//----------------------------------------------------------------
+BLAKE3::Output BLAKE3::parentOutput(const std::uint32_t left[8], const std::uint32_t right[8])
+{
+  Output output;
+  std::memcpy(output.cv, IV, sizeof(output.cv));
+  std::memcpy(output.block, left, 32);
+  std::memcpy(output.block + 32, right, 32);
+  output.length  = 64;
+  output.counter = 0;
+  output.flags   = PARENT;
+
+  return output;
+}
+
+//----------------------------------------------------------------
+void BLAKE3::mergeStack(const unsigned long long chunks)
+{
+  const auto length = __builtin_popcountll(chunks);
+
+  while(m_stackLength > length)
+  {
+    parentOutput(m_stack[m_stackLength - 2], m_stack[m_stackLength - 1]).chainingValue(m_stack[m_stackLength - 2]);
+    --m_stackLength;
+  }
+}
+
+//----------------------------------------------------------------
+void BLAKE3::pushChainingValue(const std::uint32_t cv[8], const unsigned long long counter)
+{
+  mergeStack(counter);
+
+  std::memcpy(m_stack[m_stackLength], cv, sizeof(m_stack[0]));
+  ++m_stackLength;
+}
+
+//----------------------------------------------------------------
+void BLAKE3::hashSubtree(const unsigned char *data, const unsigned long long length, const unsigned long long counter, std::uint32_t out[16]) const
+{
+  std::uint32_t cvs[MAX_DEGREE * 8], parents[MAX_DEGREE * 4];
+
+  auto number = hashSubtreeWide(data, length, counter, cvs);
+
+  while(number > 2)
+  {
+    number = hashParents(cvs, number, parents);
+    std::memcpy(cvs, parents, number * 8 * sizeof(std::uint32_t));
+  }
+
+  std::memcpy(out, cvs, 16 * sizeof(std::uint32_t));
+}
+
+//----------------------------------------------------------------
+std::size_t BLAKE3::hashSubtreeWide(const unsigned char *data, const unsigned long long length, const unsigned long long counter, std::uint32_t *out) const
+{
+  const std::size_t degree = BLAKE3Kernels::degree();
+
+  if(length <= degree * CHUNK_LENGTH)
+  {
+    const auto chunks = length / CHUNK_LENGTH;
+    hashMany(data, CHUNK_LENGTH, chunks, CHUNK_LENGTH / 64, IV, counter, true, 0, CHUNK_START, CHUNK_END, out);
+    return chunks;
+  }
+
+  const auto leftLength   = leftSubtreeLength(length);
+  const auto rightCounter = counter + leftLength / CHUNK_LENGTH;
+
+  // the left subtree is complete and returns as many chaining values as the degree, but at
+  // least two if it has more than one chunk.
+  const auto width = (degree == 1 && leftLength > CHUNK_LENGTH) ? 2 : degree;
+  std::uint32_t cvs[2 * MAX_DEGREE * 8];
+  std::size_t leftNumber = 0;
+
+  QSemaphore done;
+  auto hashLeft = [&]() { leftNumber = hashSubtreeWide(data, leftLength, counter, cvs); };
+
+  // the left subtree is hashed in the calling thread if there isn't a free thread in the pool.
+  const auto parallel = m_pool && (leftLength >= PARALLEL_SUBTREE_LENGTH) && m_pool->tryStart([&]() { hashLeft(); done.release(); });
+  if(!parallel) hashLeft();
+
+  const auto rightNumber = hashSubtreeWide(data + leftLength, length - leftLength, rightCounter, cvs + width * 8);
+
+  if(parallel) done.acquire();
+
+  // without SIMD both children are returned to have two chaining values.
+  if(leftNumber == 1)
+  {
+    std::memcpy(out, cvs, 16 * sizeof(std::uint32_t));
+    return 2;
+  }
+
+  return hashParents(cvs, leftNumber + rightNumber, out);
+}
+
+//----------------------------------------------------------------
+std::size_t BLAKE3::hashParents(const std::uint32_t *cvs, const std::size_t number, std::uint32_t *out)
+{
+  const auto pairs = number / 2;
+  hashMany(reinterpret_cast<const unsigned char *>(cvs), 64, pairs, 1, IV, 0, false, PARENT, 0, 0, out);
+
+  if(number % 2 != 0)
+  {
+    std::memcpy(out + pairs * 8, cvs + pairs * 16, 8 * sizeof(std::uint32_t));
+    return pairs + 1;
+  }
+
+  return pairs;
+}
@@ -0,0 +1,186 @@
+/*
+ File: BLAKE3.h
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HASH_BLAKE3_H_
+#define HASH_BLAKE3_H_
+
+// Project
+#include <Hash.h>
+
+// C++
+#include <cstdint>
+
+class QThreadPool;
+
+/** \class BLAKE3
+ * \brief Implements the BLAKE3 hash of 256 bits. The message is divided in chunks of 1024 bytes
+ *        that are the leaves of a binary tree, the chunks of large updates are compressed
+ *        at the same time with the SIMD kernels and the subtrees can be hashed by the threads
+ *        of a pool.
+ *
+ */
+class BLAKE3
+: public Hash
+{
+  public:
+    /** \brief BLAKE3 class constructor.
+     *
+     */
+    BLAKE3();
+
+    /** \brief BLAKE3 class virtual destructor.
+     *
+     */
+    virtual ~BLAKE3()
+    {};
+
+    virtual const int blockSize() const override
+    { return 64; }
+
+    virtual const QString value() const override;
+
+    virtual const QString name() const override
+    { return QString("BLAKE3"); }
+
+    virtual Algorithms::Id algorithm() const override
+    { return Algorithms::Id::BLAKE3; }
+
+    virtual void reset() override;
+
+    virtual void update(const unsigned char *data, const unsigned long long length) override;
+
+    virtual void finalize() override;
+
+    /** \brief Sets the pool of threads used to hash the subtrees of large updates. The pool
+     * must exist while the hash is being updated.
+     * \param[in] pool thread pool or nullptr to hash the subtrees in the calling thread.
+     *
+     */
+    void setThreadPool(QThreadPool *pool)
+    { m_pool = pool; }
+
+  private:
+    /** \struct Output
+     * \brief Input of the last compression of a node, it can produce the chaining value
+     *        of the node or the hash value if it's the root of the tree.
+     *
+     */
+    struct Output
+    {
+      std::uint32_t      cv[8];     /** input chaining value.    */
+      unsigned char      block[64]; /** last block of the node.  */
+      std::uint8_t       length;    /** length of the block.     */
+      unsigned long long counter;   /** chunk counter.           */
+      std::uint8_t       flags;     /** domain separation flags. */
+
+      /** \brief Computes the chaining value of the node.
+       * \param[out] result chaining value.
+       *
+       */
+      void chainingValue(std::uint32_t result[8]) const;
+    };
+
+    /** \brief Compresses the given number of blocks of the current chunk, none of them is the last one.
+     * \param[in] blocks data buffer.
+     * \param[in] number number of blocks in the buffer.
+     *
+     */
+    virtual void process_blocks(const unsigned char *blocks, const unsigned long long number) override;
+
+    /** \brief Adds the data to the current chunk, the data must fit in the chunk. The last block
+     * is kept in the buffer until more data is added.
+     * \param[in] data data buffer.
+     * \param[in] length length of the data buffer in bytes.
+     *
+     */
+    void chunkUpdate(const unsigned char *data, unsigned long long length);
+
+    /** \brief Returns the number of bytes in the current chunk.
+     *
+     */
+    unsigned long long chunkLength() const;
+
+    /** \brief Returns the output of the current chunk.
+     *
+     */
+    Output chunkOutput() const;
+
+    /** \brief Returns the output of a parent node.
+     * \param[in] left chaining value of the left child.
+     * \param[in] right chaining value of the right child.
+     *
+     */
+    static Output parentOutput(const std::uint32_t left[8], const std::uint32_t right[8]);
+
+    /** \brief Merges the chaining values of the stack that are complete subtrees, leaving one for
+     * each bit set in the number of chunks. The last one is kept as it could be the root.
+     * \param[in] chunks number of chunks hashed.
+     *
+     */
+    void mergeStack(const unsigned long long chunks);
+
+    /** \brief Adds a chaining value to the stack after merging the complete subtrees.
+     * \param[in] cv chaining value of a chunk or a subtree.
+     * \param[in] counter counter of the first chunk of the subtree.
+     *
+     */
+    void pushChainingValue(const std::uint32_t cv[8], const unsigned long long counter);
+
+    /** \brief Hashes a subtree of complete chunks and returns the chaining values of the two
+     * children of its root node.
+     * \param[in] data subtree data, a power of two number of chunks.
+     * \param[in] length length of the data in bytes.
+     * \param[in] counter counter of the first chunk.
+     * \param[out] out chaining values of the children.
+     *
+     */
+    void hashSubtree(const unsigned char *data, const unsigned long long length, const unsigned long long counter, std::uint32_t out[16]) const;
+
+    /** \brief Hashes a subtree of complete chunks up to the number of chaining values of the
+     * SIMD degree, the left and right subtrees can be hashed by different threads. Returns
+     * the number of chaining values.
+     * \param[in] data subtree data.
+     * \param[in] length length of the data in bytes.
+     * \param[in] counter counter of the first chunk.
+     * \param[out] out chaining values.
+     *
+     */
+    std::size_t hashSubtreeWide(const unsigned char *data, const unsigned long long length, const unsigned long long counter, std::uint32_t *out) const;
+
+    /** \brief Compresses pairs of chaining values as parent nodes and returns the number of
+     * chaining values of the next level.
+     * \param[in] cvs chaining values.
+     * \param[in] number number of chaining values.
+     * \param[out] out chaining values of the parents, the last one is copied if the number is odd.
+     *
+     */
+    static std::size_t hashParents(const std::uint32_t *cvs, const std::size_t number, std::uint32_t *out);
+
+    static const int MAX_DEPTH = 54; /** maximum depth of the tree, 2^64 bytes. */
+
+    std::uint32_t      m_chunkCV[8];              /** chaining value of the current chunk.             */
+    unsigned long long m_chunkCounter;            /** counter of the current chunk.                    */
+    int                m_blocksCompressed;        /** number of blocks compressed of the current chunk. */
+    std::uint32_t      m_stack[MAX_DEPTH + 1][8]; /** chaining values of the subtrees not merged.      */
+    int                m_stackLength;             /** number of chaining values in the stack.          */
+    unsigned char      m_hash[32];                /** hash value.                                      */
+    QThreadPool       *m_pool;                    /** pool for the subtrees or nullptr if none.        */
+};
+
+#endif // HASH_BLAKE3_H_
@@ -0,0 +1,520 @@
+/*
+ File: BLAKE3Kernels.cpp
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Project
+#include <hash/BLAKE3Kernels.h>
+#include <CPUFeatures.h>
+
+// C++
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define BLAKE3_SIMD_KERNELS
+#include <immintrin.h>
+#endif
+
+const std::uint32_t BLAKE3Kernels::IV[8] =
+{
+  0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19
+};
+
+/** Message words permutation of each round. */
+static const std::uint8_t SCHEDULE[7][16] =
+{
+  {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 },
+  {  2,  6,  3, 10,  7,  0,  4, 13,  1, 11, 12,  5,  9, 14, 15,  8 },
+  {  3,  4, 10, 12, 13,  2,  7, 14,  6,  5,  9,  0, 11, 15,  8,  1 },
+  { 10,  7, 12,  9, 14,  3, 13, 15,  4,  0, 11,  2,  5,  8,  1,  6 },
+  { 12, 13,  9, 11, 15, 10, 14,  8,  7,  2,  5,  3,  0,  1,  6,  4 },
+  {  9, 14, 11,  5,  8, 12, 15,  1, 13,  3,  0, 10,  2,  6,  4,  7 },
+  { 11, 15,  5,  0,  1,  9,  8,  6, 14, 10,  2, 12,  3,  4,  7, 13 }
+};
+
+/** \brief Rotational shift to the right of the 32 bits value.
+ * \param[in] x value.
+ * \param[in] n number of bits.
+ *
+ */
+static inline std::uint32_t rotr(const std::uint32_t x, const int n)
+{
+  return (x >> n) | (x << (32 - n));
+}
+
+/** \brief Mixing function of the state words.
+ * \param[inout] a b c d state words.
+ * \param[in] x y message words.
+ *
+ */
+static inline void g(std::uint32_t &a, std::uint32_t &b, std::uint32_t &c, std::uint32_t &d, const std::uint32_t x, const std::uint32_t y)
+{
+  a = a + b + x;
+  d = rotr(d ^ a, 16);
+  c = c + d;
+  b = rotr(b ^ c, 12);
+  a = a + b + y;
+  d = rotr(d ^ a, 8);
+  c = c + d;
+  b = rotr(b ^ c, 7);
+}
+
+#ifdef BLAKE3_SIMD_KERNELS
+
+/** \brief Counters of the inputs compressed at the same time.
+ * \param[in] counter counter of the first input.
+ * \param[in] increment true to increment the counter for each input.
+ * \param[in] lanes number of inputs.
+ * \param[out] low low words of the counters.
+ * \param[out] high high words of the counters.
+ *
+ */
+static void laneCounters(const unsigned long long counter, const bool increment, const int lanes, std::uint32_t low[], std::uint32_t high[])
+{
+  for(int i = 0; i < lanes; ++i)
+  {
+    const auto value = counter + (increment ? i : 0);
+    low[i]  = static_cast<std::uint32_t>(value);
+    high[i] = static_cast<std::uint32_t>(value >> 32);
+  }
+}
+
+//----------------------------------------------------------------
+__attribute__((target("sse4.1")))
+static inline void gSSE41(__m128i &a, __m128i &b, __m128i &c, __m128i &d, const __m128i x, const __m128i y)
+{
+  const __m128i ROT16 = _mm_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+  const __m128i ROT8  = _mm_setr_epi8(1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12);
+
+  a = _mm_add_epi32(_mm_add_epi32(a, b), x);
+  d = _mm_shuffle_epi8(_mm_xor_si128(d, a), ROT16);
+  c = _mm_add_epi32(c, d);
+  b = _mm_xor_si128(b, c);
+  b = _mm_or_si128(_mm_srli_epi32(b, 12), _mm_slli_epi32(b, 20));
+  a = _mm_add_epi32(_mm_add_epi32(a, b), y);
+  d = _mm_shuffle_epi8(_mm_xor_si128(d, a), ROT8);
+  c = _mm_add_epi32(c, d);
+  b = _mm_xor_si128(b, c);
+  b = _mm_or_si128(_mm_srli_epi32(b, 7), _mm_slli_epi32(b, 25));
+}
+
+//----------------------------------------------------------------
+__attribute__((target("sse4.1")))
+static inline void transposeSSE41(__m128i v[4])
+{
+  const auto ab01 = _mm_unpacklo_epi32(v[0], v[1]);
+  const auto ab23 = _mm_unpackhi_epi32(v[0], v[1]);
+  const auto cd01 = _mm_unpacklo_epi32(v[2], v[3]);
+  const auto cd23 = _mm_unpackhi_epi32(v[2], v[3]);
+
+  v[0] = _mm_unpacklo_epi64(ab01, cd01);
+  v[1] = _mm_unpackhi_epi64(ab01, cd01);
+  v[2] = _mm_unpacklo_epi64(ab23, cd23);
+  v[3] = _mm_unpackhi_epi64(ab23, cd23);
+}
+
+//----------------------------------------------------------------
+__attribute__((target("sse4.1")))
+static void hash4SSE41(const unsigned char *inputs, const std::size_t stride, const int blocks, const std::uint32_t key[8],
+                       const unsigned long long counter, const bool increment, const std::uint8_t flags,
+                       const std::uint8_t flagsStart, const std::uint8_t flagsEnd, std::uint32_t *out)
+{
+  std::uint32_t low[4], high[4];
+  laneCounters(counter, increment, 4, low, high);
+
+  const auto counterLow  = _mm_loadu_si128(reinterpret_cast<const __m128i *>(low));
+  const auto counterHigh = _mm_loadu_si128(reinterpret_cast<const __m128i *>(high));
+
+  __m128i h[8], v[16], m[16];
+  for(int i = 0; i < 8; ++i) h[i] = _mm_set1_epi32(key[i]);
+
+  for(int block = 0; block < blocks; ++block)
+  {
+    const auto blockFlags = flags | (block == 0 ? flagsStart : 0) | (block == blocks - 1 ? flagsEnd : 0);
+
+    // each vector holds the same message word of the four inputs.
+    for(int quarter = 0; quarter < 4; ++quarter)
+    {
+      for(int lane = 0; lane < 4; ++lane)
+      {
+        m[4 * quarter + lane] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(inputs + lane * stride + block * 64 + quarter * 16));
+      }
+      transposeSSE41(&m[4 * quarter]);
+    }
+
+    for(int i = 0; i < 8; ++i) v[i] = h[i];
+    for(int i = 0; i < 4; ++i) v[8 + i] = _mm_set1_epi32(BLAKE3Kernels::IV[i]);
+    v[12] = counterLow;
+    v[13] = counterHigh;
+    v[14] = _mm_set1_epi32(64);
+    v[15] = _mm_set1_epi32(blockFlags);
+
+#pragma GCC unroll 7
+    for(int round = 0; round < 7; ++round)
+    {
+      const auto s = SCHEDULE[round];
+      gSSE41(v[0], v[4], v[ 8], v[12], m[s[ 0]], m[s[ 1]]);
+      gSSE41(v[1], v[5], v[ 9], v[13], m[s[ 2]], m[s[ 3]]);
+      gSSE41(v[2], v[6], v[10], v[14], m[s[ 4]], m[s[ 5]]);
+      gSSE41(v[3], v[7], v[11], v[15], m[s[ 6]], m[s[ 7]]);
+      gSSE41(v[0], v[5], v[10], v[15], m[s[ 8]], m[s[ 9]]);
+      gSSE41(v[1], v[6], v[11], v[12], m[s[10]], m[s[11]]);
+      gSSE41(v[2], v[7], v[ 8], v[13], m[s[12]], m[s[13]]);
+      gSSE41(v[3], v[4], v[ 9], v[14], m[s[14]], m[s[15]]);
+    }
+
+    for(int i = 0; i < 8; ++i) h[i] = _mm_xor_si128(v[i], v[i + 8]);
+  }
+
+  transposeSSE41(&h[0]);
+  transposeSSE41(&h[4]);
+
+  for(int lane = 0; lane < 4; ++lane)
+  {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 8 * lane), h[lane]);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 8 * lane + 4), h[4 + lane]);
+  }
+}
+
+//----------------------------------------------------------------
+__attribute__((target("avx2")))
+static inline void gAVX2(__m256i &a, __m256i &b, __m256i &c, __m256i &d, const __m256i x, const __m256i y)
+{
+  const __m256i ROT16 = _mm256_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+                                         2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+  const __m256i ROT8  = _mm256_setr_epi8(1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12,
+                                         1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12);
+
+  a = _mm256_add_epi32(_mm256_add_epi32(a, b), x);
+  d = _mm256_shuffle_epi8(_mm256_xor_si256(d, a), ROT16);
+  c = _mm256_add_epi32(c, d);
+  b = _mm256_xor_si256(b, c);
+  b = _mm256_or_si256(_mm256_srli_epi32(b, 12), _mm256_slli_epi32(b, 20));
+  a = _mm256_add_epi32(_mm256_add_epi32(a, b), y);
+  d = _mm256_shuffle_epi8(_mm256_xor_si256(d, a), ROT8);
+  c = _mm256_add_epi32(c, d);
+  b = _mm256_xor_si256(b, c);
+  b = _mm256_or_si256(_mm256_srli_epi32(b, 7), _mm256_slli_epi32(b, 25));
+}
+
+//----------------------------------------------------------------
+__attribute__((target("avx2")))
+static inline void transposeAVX2(__m256i v[8])
+{
+  const auto ab0145 = _mm256_unpacklo_epi32(v[0], v[1]);
+  const auto ab2367 = _mm256_unpackhi_epi32(v[0], v[1]);
+  const auto cd0145 = _mm256_unpacklo_epi32(v[2], v[3]);
+  const auto cd2367 = _mm256_unpackhi_epi32(v[2], v[3]);
+  const auto ef0145 = _mm256_unpacklo_epi32(v[4], v[5]);
+  const auto ef2367 = _mm256_unpackhi_epi32(v[4], v[5]);
+  const auto gh0145 = _mm256_unpacklo_epi32(v[6], v[7]);
+  const auto gh2367 = _mm256_unpackhi_epi32(v[6], v[7]);
+
+  const auto abcd04 = _mm256_unpacklo_epi64(ab0145, cd0145);
+  const auto abcd15 = _mm256_unpackhi_epi64(ab0145, cd0145);
+  const auto abcd26 = _mm256_unpacklo_epi64(ab2367, cd2367);
+  const auto abcd37 = _mm256_unpackhi_epi64(ab2367, cd2367);
+  const auto efgh04 = _mm256_unpacklo_epi64(ef0145, gh0145);
+  const auto efgh15 = _mm256_unpackhi_epi64(ef0145, gh0145);
+  const auto efgh26 = _mm256_unpacklo_epi64(ef2367, gh2367);
+  const auto efgh37 = _mm256_unpackhi_epi64(ef2367, gh2367);
+
+  v[0] = _mm256_permute2x128_si256(abcd04, efgh04, 0x20);
+  v[1] = _mm256_permute2x128_si256(abcd15, efgh15, 0x20);
+  v[2] = _mm256_permute2x128_si256(abcd26, efgh26, 0x20);
+  v[3] = _mm256_permute2x128_si256(abcd37, efgh37, 0x20);
+  v[4] = _mm256_permute2x128_si256(abcd04, efgh04, 0x31);
+  v[5] = _mm256_permute2x128_si256(abcd15, efgh15, 0x31);
+  v[6] = _mm256_permute2x128_si256(abcd26, efgh26, 0x31);
+  v[7] = _mm256_permute2x128_si256(abcd37, efgh37, 0x31);
+}
+
+//----------------------------------------------------------------
+__attribute__((target("avx2")))
+static void hash8AVX2(const unsigned char *inputs, const std::size_t stride, const int blocks, const std::uint32_t key[8],
+                      const unsigned long long counter, const bool increment, const std::uint8_t flags,
+                      const std::uint8_t flagsStart, const std::uint8_t flagsEnd, std::uint32_t *out)
+{
+  std::uint32_t low[8], high[8];
+  laneCounters(counter, increment, 8, low, high);
+
+  const auto counterLow  = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(low));
+  const auto counterHigh = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(high));
+
+  __m256i h[8], v[16], m[16];
+  for(int i = 0; i < 8; ++i) h[i] = _mm256_set1_epi32(key[i]);
+
+  for(int block = 0; block < blocks; ++block)
+  {
+    const auto blockFlags = flags | (block == 0 ? flagsStart : 0) | (block == blocks - 1 ? flagsEnd : 0);
+
+    // each vector holds the same message word of the eight inputs.
+    for(int half = 0; half < 2; ++half)
+    {
+      for(int lane = 0; lane < 8; ++lane)
+      {
+        m[8 * half + lane] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(inputs + lane * stride + block * 64 + half * 32));
+      }
+      transposeAVX2(&m[8 * half]);
+    }
+
+    for(int i = 0; i < 8; ++i) v[i] = h[i];
+    for(int i = 0; i < 4; ++i) v[8 + i] = _mm256_set1_epi32(BLAKE3Kernels::IV[i]);
+    v[12] = counterLow;
+    v[13] = counterHigh;
+    v[14] = _mm256_set1_epi32(64);
+    v[15] = _mm256_set1_epi32(blockFlags);
+
+#pragma GCC unroll 7
+    for(int round = 0; round < 7; ++round)
+    {
+      const auto s = SCHEDULE[round];
+      gAVX2(v[0], v[4], v[ 8], v[12], m[s[ 0]], m[s[ 1]]);
+      gAVX2(v[1], v[5], v[ 9], v[13], m[s[ 2]], m[s[ 3]]);
+      gAVX2(v[2], v[6], v[10], v[14], m[s[ 4]], m[s[ 5]]);
+      gAVX2(v[3], v[7], v[11], v[15], m[s[ 6]], m[s[ 7]]);
+      gAVX2(v[0], v[5], v[10], v[15], m[s[ 8]], m[s[ 9]]);
+      gAVX2(v[1], v[6], v[11], v[12], m[s[10]], m[s[11]]);
+      gAVX2(v[2], v[7], v[ 8], v[13], m[s[12]], m[s[13]]);
+      gAVX2(v[3], v[4], v[ 9], v[14], m[s[14]], m[s[15]]);
+    }
+
+    for(int i = 0; i < 8; ++i) h[i] = _mm256_xor_si256(v[i], v[i + 8]);
+  }
+
+  transposeAVX2(h);
+
+  for(int lane = 0; lane < 8; ++lane)
+  {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + 8 * lane), h[lane]);
+  }
+}
+
+// the AVX-512 intrinsics of GCC 12 build their results over undefined vectors, and GCC warns
+// about its own headers once they are inlined here.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+//----------------------------------------------------------------
+__attribute__((target("avx512f")))
+static inline void gAVX512(__m512i &a, __m512i &b, __m512i &c, __m512i &d, const __m512i x, const __m512i y)
+{
+  a = _mm512_add_epi32(_mm512_add_epi32(a, b), x);
+  d = _mm512_ror_epi32(_mm512_xor_si512(d, a), 16);
+  c = _mm512_add_epi32(c, d);
+  b = _mm512_ror_epi32(_mm512_xor_si512(b, c), 12);
+  a = _mm512_add_epi32(_mm512_add_epi32(a, b), y);
+  d = _mm512_ror_epi32(_mm512_xor_si512(d, a), 8);
+  c = _mm512_add_epi32(c, d);
+  b = _mm512_ror_epi32(_mm512_xor_si512(b, c), 7);
+}
+
+//----------------------------------------------------------------
+__attribute__((target("avx512f")))
+static inline void transposeAVX512(__m512i v[16])
+{
+  __m512i t[16];
+
+  // interleave the 32 bits words of pairs of vectors.
+  for(int i = 0; i < 8; ++i)
+  {
+    t[2 * i]     = _mm512_unpacklo_epi32(v[2 * i], v[2 * i + 1]);
+    t[2 * i + 1] = _mm512_unpackhi_epi32(v[2 * i], v[2 * i + 1]);
+  }
+
+  // interleave the 64 bits words, each 128 bits lane holds a column of four vectors.
+  for(int i = 0; i < 4; ++i)
+  {
+    v[4 * i]     = _mm512_unpacklo_epi64(t[4 * i],     t[4 * i + 2]);
+    v[4 * i + 1] = _mm512_unpackhi_epi64(t[4 * i],     t[4 * i + 2]);
+    v[4 * i + 2] = _mm512_unpacklo_epi64(t[4 * i + 1], t[4 * i + 3]);
+    v[4 * i + 3] = _mm512_unpackhi_epi64(t[4 * i + 1], t[4 * i + 3]);
+  }
+
+  // interleave the 128 bits lanes twice.
+  for(int i = 0; i < 2; ++i)
+  {
+    for(int j = 0; j < 4; ++j)
+    {
+      t[8 * i + j]     = _mm512_shuffle_i32x4(v[8 * i + j], v[8 * i + 4 + j], _MM_SHUFFLE(1, 0, 1, 0));
+      t[8 * i + 4 + j] = _mm512_shuffle_i32x4(v[8 * i + j], v[8 * i + 4 + j], _MM_SHUFFLE(3, 2, 3, 2));
+    }
+  }
+
+  for(int i = 0; i < 4; ++i)
+  {
+    v[i]      = _mm512_shuffle_i32x4(t[i],     t[8 + i],  _MM_SHUFFLE(2, 0, 2, 0));
+    v[4 + i]  = _mm512_shuffle_i32x4(t[i],     t[8 + i],  _MM_SHUFFLE(3, 1, 3, 1));
+    v[8 + i]  = _mm512_shuffle_i32x4(t[4 + i], t[12 + i], _MM_SHUFFLE(2, 0, 2, 0));
+    v[12 + i] = _mm512_shuffle_i32x4(t[4 + i], t[12 + i], _MM_SHUFFLE(3, 1, 3, 1));
+  }
+}
+
+//----------------------------------------------------------------
+__attribute__((target("avx512f")))
+static void hash16AVX512(const unsigned char *inputs, const std::size_t stride, const int blocks, const std::uint32_t key[8],
+                         const unsigned long long counter, const bool increment, const std::uint8_t flags,
+                         const std::uint8_t flagsStart, const std::uint8_t flagsEnd, std::uint32_t *out)
+{
+  std::uint32_t low[16], high[16];
+  laneCounters(counter, increment, 16, low, high);
+
+  const auto counterLow  = _mm512_loadu_si512(low);
+  const auto counterHigh = _mm512_loadu_si512(high);
+
+  __m512i h[16], v[16], m[16];
+  for(int i = 0; i < 8; ++i) h[i] = _mm512_set1_epi32(key[i]);
+
+  for(int block = 0; block < blocks; ++block)
+  {
+    const auto blockFlags = flags | (block == 0 ? flagsStart : 0) | (block == blocks - 1 ? flagsEnd : 0);
+
+    // each vector holds the same message word of the sixteen inputs.
+    for(int lane = 0; lane < 16; ++lane)
+    {
+      m[lane] = _mm512_loadu_si512(inputs + lane * stride + block * 64);
+    }
+    transposeAVX512(m);
+
+    for(int i = 0; i < 8; ++i) v[i] = h[i];
+    for(int i = 0; i < 4; ++i) v[8 + i] = _mm512_set1_epi32(BLAKE3Kernels::IV[i]);
+    v[12] = counterLow;
+    v[13] = counterHigh;
+    v[14] = _mm512_set1_epi32(64);
+    v[15] = _mm512_set1_epi32(blockFlags);
+
+#pragma GCC unroll 7
+    for(int round = 0; round < 7; ++round)
+    {
+      const auto s = SCHEDULE[round];
+      gAVX512(v[0], v[4], v[ 8], v[12], m[s[ 0]], m[s[ 1]]);
+      gAVX512(v[1], v[5], v[ 9], v[13], m[s[ 2]], m[s[ 3]]);
+      gAVX512(v[2], v[6], v[10], v[14], m[s[ 4]], m[s[ 5]]);
+      gAVX512(v[3], v[7], v[11], v[15], m[s[ 6]], m[s[ 7]]);
+      gAVX512(v[0], v[5], v[10], v[15], m[s[ 8]], m[s[ 9]]);
+      gAVX512(v[1], v[6], v[11], v[12], m[s[10]], m[s[11]]);
+      gAVX512(v[2], v[7], v[ 8], v[13], m[s[12]], m[s[13]]);
+      gAVX512(v[3], v[4], v[ 9], v[14], m[s[14]], m[s[15]]);
+    }
+
+    for(int i = 0; i < 8; ++i) h[i] = _mm512_xor_si512(v[i], v[i + 8]);
+  }
+
+  // the lower half of each transposed vector is the chaining value of an input.
+  for(int i = 8; i < 16; ++i) h[i] = _mm512_setzero_si512();
+  transposeAVX512(h);
+
+  for(int lane = 0; lane < 16; ++lane)
+  {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + 8 * lane), _mm512_castsi512_si256(h[lane]));
+  }
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif // BLAKE3_SIMD_KERNELS
+
+//----------------------------------------------------------------
+int BLAKE3Kernels::degree()
+{
+#ifdef BLAKE3_SIMD_KERNELS
+  static const int value = CPUFeatures::hasAVX512() ? 16 : (CPUFeatures::hasAVX2() ? 8 : (CPUFeatures::hasSSE41() ? 4 : 1));
+
+  return value;
+#else
+  return 1;
+#endif
+}
+
+//----------------------------------------------------------------
+void BLAKE3Kernels::compress(std::uint32_t cv[8], const unsigned char block[64], const std::uint8_t length, const unsigned long long counter, const std::uint8_t flags)
+{
+  std::uint32_t m[16];
+  std::memcpy(m, block, sizeof(m));
+
+  std::uint32_t v[16] =
+  {
+    cv[0], cv[1], cv[2], cv[3], cv[4], cv[5], cv[6], cv[7],
+    IV[0], IV[1], IV[2], IV[3],
+    static_cast<std::uint32_t>(counter), static_cast<std::uint32_t>(counter >> 32), length, flags
+  };
+
+  for(int round = 0; round < 7; ++round)
+  {
+    const auto s = SCHEDULE[round];
+    g(v[0], v[4], v[ 8], v[12], m[s[ 0]], m[s[ 1]]);
+    g(v[1], v[5], v[ 9], v[13], m[s[ 2]], m[s[ 3]]);
+    g(v[2], v[6], v[10], v[14], m[s[ 4]], m[s[ 5]]);
+    g(v[3], v[7], v[11], v[15], m[s[ 6]], m[s[ 7]]);
+    g(v[0], v[5], v[10], v[15], m[s[ 8]], m[s[ 9]]);
+    g(v[1], v[6], v[11], v[12], m[s[10]], m[s[11]]);
+    g(v[2], v[7], v[ 8], v[13], m[s[12]], m[s[13]]);
+    g(v[3], v[4], v[ 9], v[14], m[s[14]], m[s[15]]);
+  }
+
+  for(int i = 0; i < 8; ++i)
+  {
+    cv[i] = v[i] ^ v[i + 8];
+  }
+}
+
+//----------------------------------------------------------------
+void BLAKE3Kernels::hashMany(const unsigned char *inputs, const std::size_t stride, std::size_t number, const int blocks,
+                             const std::uint32_t key[8], unsigned long long counter, const bool increment,
+                             const std::uint8_t flags, const std::uint8_t flagsStart, const std::uint8_t flagsEnd, std::uint32_t *out)
+{
+#ifdef BLAKE3_SIMD_KERNELS
+  // the widest kernel first, the remaining inputs are compressed by the narrower ones.
+  const auto width = degree();
+
+  for(; width >= 16 && number >= 16; number -= 16, inputs += 16 * stride, out += 16 * 8)
+  {
+    hash16AVX512(inputs, stride, blocks, key, counter, increment, flags, flagsStart, flagsEnd, out);
+    if(increment) counter += 16;
+  }
+
+  for(; width >= 8 && number >= 8; number -= 8, inputs += 8 * stride, out += 8 * 8)
+  {
+    hash8AVX2(inputs, stride, blocks, key, counter, increment, flags, flagsStart, flagsEnd, out);
+    if(increment) counter += 8;
+  }
+
+  for(; width >= 4 && number >= 4; number -= 4, inputs += 4 * stride, out += 4 * 8)
+  {
+    hash4SSE41(inputs, stride, blocks, key, counter, increment, flags, flagsStart, flagsEnd, out);
+    if(increment) counter += 4;
+  }
+#endif
+
+  for(; number > 0; --number, inputs += stride, out += 8)
+  {
+    std::memcpy(out, key, 8 * sizeof(std::uint32_t));
+
+    for(int block = 0; block < blocks; ++block)
+    {
+      const auto blockFlags = flags | (block == 0 ? flagsStart : 0) | (block == blocks - 1 ? flagsEnd : 0);
+      compress(out, inputs + block * 64, 64, counter, blockFlags);
+    }
+
+    if(increment) ++counter;
+  }
+}
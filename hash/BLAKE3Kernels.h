@@ -0,0 +1,78 @@
+/*
+ File: BLAKE3Kernels.h
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HASH_BLAKE3KERNELS_H_
+#define HASH_BLAKE3KERNELS_H_
+
+// C++
+#include <cstddef>
+#include <cstdint>
+
+/** BLAKE3 compression functions, the SIMD versions compress several inputs at the same time. */
+namespace BLAKE3Kernels
+{
+  /** Domain separation flags. */
+  const std::uint8_t CHUNK_START = 1 << 0;
+  const std::uint8_t CHUNK_END   = 1 << 1;
+  const std::uint8_t PARENT      = 1 << 2;
+  const std::uint8_t ROOT        = 1 << 3;
+
+  /** Maximum number of inputs compressed at the same time by the kernels. */
+  const int MAX_DEGREE = 16;
+
+  /** Initialization vector, the same as SHA-256. */
+  extern const std::uint32_t IV[8];
+
+  /** \brief Returns the number of inputs compressed at the same time by the best kernel
+   * supported by the processor.
+   *
+   */
+  int degree();
+
+  /** \brief Compresses one block in place.
+   * \param[inout] cv chaining value.
+   * \param[in] block block data, padded with zeroes.
+   * \param[in] length number of bytes of the block.
+   * \param[in] counter chunk counter or output block counter.
+   * \param[in] flags domain separation flags.
+   *
+   */
+  void compress(std::uint32_t cv[8], const unsigned char block[64], const std::uint8_t length, const unsigned long long counter, const std::uint8_t flags);
+
+  /** \brief Compresses the complete blocks of several inputs placed at regular intervals in
+   * memory and stores their chaining values contiguously.
+   * \param[in] inputs data of the first input.
+   * \param[in] stride distance in bytes between the inputs.
+   * \param[in] number number of inputs.
+   * \param[in] blocks number of blocks of each input.
+   * \param[in] key initial chaining value.
+   * \param[in] counter counter of the first input.
+   * \param[in] increment true to increment the counter for each input and false to use the same.
+   * \param[in] flags flags of all the blocks.
+   * \param[in] flagsStart flags added to the first block of each input.
+   * \param[in] flagsEnd flags added to the last block of each input.
+   * \param[out] out chaining values, 8 words for each input.
+   *
+   */
+  void hashMany(const unsigned char *inputs, const std::size_t stride, const std::size_t number, const int blocks,
+                const std::uint32_t key[8], const unsigned long long counter, const bool increment,
+                const std::uint8_t flags, const std::uint8_t flagsStart, const std::uint8_t flagsEnd, std::uint32_t *out);
+}
+
+#endif // HASH_BLAKE3KERNELS_H_
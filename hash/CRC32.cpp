@@ -0,0 +1,176 @@
+/*
+ File: CRC32.cpp
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Project
+#include <hash/CRC32.h>
+#include <CPUFeatures.h>
+
+// C++
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CRC32_SIMD_KERNELS
+#include <immintrin.h>
+#endif
+
+const CRC32::Table CRC32::TABLE = CRC32::generateTable(0xEDB88320);
+
+#ifdef CRC32_SIMD_KERNELS
+
+/** \brief Returns the checksum updated with the given blocks folding four 128 bits lanes with
+ * carry-less multiplications and reducing the result with Barrett's method.
+ * \param[in] crc checksum value.
+ * \param[in] data data buffer.
+ * \param[in] length length of the data buffer in bytes, multiple of 64.
+ *
+ */
+__attribute__((target("pclmul,sse4.1")))
+static std::uint32_t updatePCLMUL(const std::uint32_t crc, const unsigned char *data, unsigned long long length)
+{
+  // x^(4*128+32) and x^(4*128-32), x^(128+32) and x^(128-32), x^64 mod P, P and mu.
+  alignas(16) static const std::uint64_t K1K2[2] = { 0x0154442bd4ULL, 0x01c6e41596ULL };
+  alignas(16) static const std::uint64_t K3K4[2] = { 0x01751997d0ULL, 0x00ccaa009eULL };
+  alignas(16) static const std::uint64_t K5K0[2] = { 0x0163cd6124ULL, 0x0000000000ULL };
+  alignas(16) static const std::uint64_t POLY[2] = { 0x01db710641ULL, 0x01f7011641ULL };
+
+  auto block = reinterpret_cast<const __m128i *>(data);
+
+  auto x1 = _mm_xor_si128(_mm_loadu_si128(block + 0), _mm_cvtsi32_si128(static_cast<int>(crc)));
+  auto x2 = _mm_loadu_si128(block + 1);
+  auto x3 = _mm_loadu_si128(block + 2);
+  auto x4 = _mm_loadu_si128(block + 3);
+  auto k  = _mm_load_si128(reinterpret_cast<const __m128i *>(K1K2));
+
+  block += 4;
+  length -= 64;
+
+  // fold 512 bits at once.
+  while(length >= 64)
+  {
+    const auto x5 = _mm_clmulepi64_si128(x1, k, 0x00);
+    const auto x6 = _mm_clmulepi64_si128(x2, k, 0x00);
+    const auto x7 = _mm_clmulepi64_si128(x3, k, 0x00);
+    const auto x8 = _mm_clmulepi64_si128(x4, k, 0x00);
+
+    x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k, 0x11), x5), _mm_loadu_si128(block + 0));
+    x2 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x2, k, 0x11), x6), _mm_loadu_si128(block + 1));
+    x3 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x3, k, 0x11), x7), _mm_loadu_si128(block + 2));
+    x4 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x4, k, 0x11), x8), _mm_loadu_si128(block + 3));
+
+    block += 4;
+    length -= 64;
+  }
+
+  // fold the four lanes into 128 bits.
+  k = _mm_load_si128(reinterpret_cast<const __m128i *>(K3K4));
+  for(const auto lane: {x2, x3, x4})
+  {
+    const auto x5 = _mm_clmulepi64_si128(x1, k, 0x00);
+    x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k, 0x11), lane), x5);
+  }
+
+  // fold 128 bits to 64 bits.
+  const auto mask = _mm_setr_epi32(~0, 0, ~0, 0);
+
+  x2 = _mm_clmulepi64_si128(x1, k, 0x10);
+  x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+  k  = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(K5K0));
+  x2 = _mm_srli_si128(x1, 4);
+  x1 = _mm_xor_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, mask), k, 0x00), x2);
+
+  // Barrett reduction to 32 bits.
+  k  = _mm_load_si128(reinterpret_cast<const __m128i *>(POLY));
+  x2 = _mm_and_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, mask), k, 0x10), mask);
+  x2 = _mm_clmulepi64_si128(x2, k, 0x00);
+  x1 = _mm_xor_si128(x1, x2);
+
+  return static_cast<std::uint32_t>(_mm_extract_epi32(x1, 1));
+}
+
+#endif // CRC32_SIMD_KERNELS
+
+//----------------------------------------------------------------
+CRC32::CRC32()
+: Hash{}
+{
+  reset();
+}
+
+//----------------------------------------------------------------
+const QString CRC32::value() const
+{
+  return QString("%1").arg(m_crc, 8, 16, QChar('0'));
+}
+
+//----------------------------------------------------------------
+void CRC32::reset()
+{
+  Hash::reset();
+
+  m_crc = 0xFFFFFFFF;
+}
+
+//----------------------------------------------------------------
+void CRC32::finalize()
+{
+  m_crc = ~updateTable(TABLE, m_crc, m_buffer, m_bufferLength);
+}
+
+//----------------------------------------------------------------
+std::uint32_t CRC32::updateTable(const Table &table, std::uint32_t crc, const unsigned char *data, unsigned long long length)
+{
+  const auto &t = table.values;
+
+  while(length >= 8)
+  {
+    std::uint32_t low, high;
+    std::memcpy(&low, data, 4);
+    std::memcpy(&high, data + 4, 4);
+    low ^= crc;
+
+    crc = t[7][low & 0xFF]  ^ t[6][(low >> 8) & 0xFF]  ^ t[5][(low >> 16) & 0xFF]  ^ t[4][low >> 24] ^
+          t[3][high & 0xFF] ^ t[2][(high >> 8) & 0xFF] ^ t[1][(high >> 16) & 0xFF] ^ t[0][high >> 24];
+
+    data += 8;
+    length -= 8;
+  }
+
+  while(length-- != 0)
+  {
+    crc = (crc >> 8) ^ t[0][(crc ^ *data++) & 0xFF];
+  }
+
+  return crc;
+}
+
+//----------------------------------------------------------------
+void CRC32::process_blocks(const unsigned char *blocks, const unsigned long long number)
+{
+#ifdef CRC32_SIMD_KERNELS
+  static const bool usePCLMUL = CPUFeatures::hasPCLMUL() && CPUFeatures::hasSSE41();
+
+  if(usePCLMUL)
+  {
+    m_crc = updatePCLMUL(m_crc, blocks, number * 64);
+    return;
+  }
+#endif
+
+  m_crc = updateTable(TABLE, m_crc, blocks, number * 64);
+}
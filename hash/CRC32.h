@@ -0,0 +1,121 @@
+/*
+ File: CRC32.h
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HASH_CRC32_H_
+#define HASH_CRC32_H_
+
+// Project
+#include <Hash.h>
+
+// C++
+#include <cstdint>
+
+/** \class CRC32
+ * \brief Implements the IEEE 802.3 cyclic redundancy check of 32 bits, the checksum of the
+ *        SFV files. Uses carry-less multiplication to fold the blocks when the processor
+ *        supports it and tables of eight bytes otherwise.
+ *
+ */
+class CRC32
+: public Hash
+{
+  public:
+    /** \brief CRC32 class constructor.
+     *
+     */
+    CRC32();
+
+    /** \brief CRC32 class virtual destructor.
+     *
+     */
+    virtual ~CRC32()
+    {};
+
+    virtual const int blockSize() const override
+    { return 64; }
+
+    virtual const QString value() const override;
+
+    virtual const QString name() const override
+    { return QString("CRC32"); }
+
+    virtual Algorithms::Id algorithm() const override
+    { return Algorithms::Id::CRC32; }
+
+    virtual void reset() override;
+
+    virtual void finalize() override;
+
+  protected:
+    /** \struct Table
+     * \brief Lookup tables to process eight bytes at once.
+     *
+     */
+    struct Table
+    {
+      std::uint32_t values[8][256]; /** remainders of the bytes for each of the eight positions. */
+    };
+
+    /** \brief Returns the lookup tables of the given reflected polynomial.
+     * \param[in] polynomial reflected polynomial.
+     *
+     */
+    static constexpr Table generateTable(const std::uint32_t polynomial)
+    {
+      Table table{};
+
+      for(std::uint32_t i = 0; i < 256; ++i)
+      {
+        auto crc = i;
+        for(int bit = 0; bit < 8; ++bit)
+        {
+          crc = (crc & 1) ? (crc >> 1) ^ polynomial : (crc >> 1);
+        }
+        table.values[0][i] = crc;
+      }
+
+      for(int i = 0; i < 256; ++i)
+      {
+        for(int j = 1; j < 8; ++j)
+        {
+          table.values[j][i] = (table.values[j - 1][i] >> 8) ^ table.values[0][table.values[j - 1][i] & 0xFF];
+        }
+      }
+
+      return table;
+    }
+
+    /** \brief Returns the checksum updated with the given data using the lookup tables.
+     * \param[in] table lookup tables.
+     * \param[in] crc checksum value.
+     * \param[in] data data buffer.
+     * \param[in] length length of the data buffer in bytes.
+     *
+     */
+    static std::uint32_t updateTable(const Table &table, std::uint32_t crc, const unsigned char *data, unsigned long long length);
+
+    std::uint32_t m_crc; /** checksum value. */
+
+  private:
+    static const Table TABLE; /** lookup tables of the reflected IEEE 802.3 polynomial. */
+
+    virtual void process_blocks(const unsigned char *blocks, const unsigned long long number) override;
+};
+
+#endif // HASH_CRC32_H_
@@ -0,0 +1,221 @@
+/*
+ File: CRC32C.cpp
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Project
+#include <hash/CRC32C.h>
+#include <CPUFeatures.h>
+
+// C++
+#include <cstring>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define CRC32C_SIMD_KERNELS
+#include <immintrin.h>
+#endif
+
+const CRC32::Table CRC32C::TABLE = CRC32::generateTable(0x82F63B78);
+
+#ifdef CRC32C_SIMD_KERNELS
+
+namespace
+{
+  constexpr std::uint32_t POLYNOMIAL = 0x82F63B78; /** reflected Castagnoli polynomial.                 */
+  constexpr unsigned long long LONG  = 8192;       /** length of the long interleaved streams in bytes.  */
+  constexpr unsigned long long SHORT = 256;        /** length of the short interleaved streams in bytes. */
+
+  /** \struct ShiftTable
+   * \brief Lookup tables of the operator that appends a number of zeros to a checksum.
+   *
+   */
+  struct ShiftTable
+  {
+    std::uint32_t values[4][256]; /** shifted values of each byte of the checksum. */
+  };
+
+  /** \brief Returns the product of the 32x32 matrix over GF(2) and the vector.
+   * \param[in] matrix matrix columns.
+   * \param[in] vector vector value.
+   *
+   */
+  constexpr std::uint32_t multiply(const std::uint32_t *matrix, std::uint32_t vector)
+  {
+    std::uint32_t sum = 0;
+    for(int i = 0; vector != 0; ++i, vector >>= 1)
+    {
+      if(vector & 1) sum ^= matrix[i];
+    }
+
+    return sum;
+  }
+
+  /** \brief Returns the tables of the operator that appends the given number of zero bytes.
+   * \param[in] length number of bytes, a power of two.
+   *
+   */
+  constexpr ShiftTable generateShiftTable(unsigned long long length)
+  {
+    // operator of one zero bit, then squared until it appends the given length.
+    std::uint32_t odd[32]{}, even[32]{};
+    odd[0] = POLYNOMIAL;
+    for(int i = 1; i < 32; ++i) odd[i] = 1u << (i - 1);
+
+    for(int i = 0; i < 32; ++i) even[i] = multiply(odd, odd[i]);
+    for(int i = 0; i < 32; ++i) odd[i] = multiply(even, even[i]);
+
+    auto *result = odd;
+    while(length != 0)
+    {
+      for(int i = 0; i < 32; ++i) even[i] = multiply(odd, odd[i]);
+      result = even;
+      length >>= 1;
+      if(length == 0) break;
+
+      for(int i = 0; i < 32; ++i) odd[i] = multiply(even, even[i]);
+      result = odd;
+      length >>= 1;
+    }
+
+    ShiftTable table{};
+    for(std::uint32_t i = 0; i < 256; ++i)
+    {
+      table.values[0][i] = multiply(result, i);
+      table.values[1][i] = multiply(result, i << 8);
+      table.values[2][i] = multiply(result, i << 16);
+      table.values[3][i] = multiply(result, i << 24);
+    }
+
+    return table;
+  }
+
+  constexpr ShiftTable LONG_SHIFT  = generateShiftTable(LONG);  /** appends the zeros of a long stream.  */
+  constexpr ShiftTable SHORT_SHIFT = generateShiftTable(SHORT); /** appends the zeros of a short stream. */
+
+  /** \brief Returns the checksum with the zeros of the table appended.
+   * \param[in] table shift table.
+   * \param[in] crc checksum value.
+   *
+   */
+  inline std::uint32_t shift(const ShiftTable &table, const std::uint32_t crc)
+  {
+    return table.values[0][crc & 0xFF] ^ table.values[1][(crc >> 8) & 0xFF] ^ table.values[2][(crc >> 16) & 0xFF] ^ table.values[3][crc >> 24];
+  }
+
+  /** \brief Returns the checksum of three interleaved streams of the given length.
+   * \param[in] table shift table of the stream length.
+   * \param[in] crc checksum value.
+   * \param[in] data data buffer.
+   * \param[in] length length of each stream in bytes.
+   *
+   */
+  __attribute__((target("sse4.2")))
+  inline std::uint64_t interleaved(const ShiftTable &table, const std::uint64_t crc, const unsigned char *data, const unsigned long long length)
+  {
+    // the three crc32 instructions are independent and hide the latency of each other.
+    std::uint64_t crc0 = crc, crc1 = 0, crc2 = 0;
+    for(const auto end = data + length; data < end; data += 8)
+    {
+      std::uint64_t value0, value1, value2;
+      std::memcpy(&value0, data, 8);
+      std::memcpy(&value1, data + length, 8);
+      std::memcpy(&value2, data + 2 * length, 8);
+
+      crc0 = _mm_crc32_u64(crc0, value0);
+      crc1 = _mm_crc32_u64(crc1, value1);
+      crc2 = _mm_crc32_u64(crc2, value2);
+    }
+
+    crc0 = shift(table, static_cast<std::uint32_t>(crc0)) ^ crc1;
+    crc0 = shift(table, static_cast<std::uint32_t>(crc0)) ^ crc2;
+
+    return crc0;
+  }
+
+  /** \brief Returns the checksum updated with the given data using the crc32 instruction.
+   * \param[in] crc checksum value.
+   * \param[in] data data buffer.
+   * \param[in] length length of the data buffer in bytes.
+   *
+   */
+  __attribute__((target("sse4.2")))
+  std::uint32_t updateSSE42(const std::uint32_t crc, const unsigned char *data, unsigned long long length)
+  {
+    std::uint64_t value = crc;
+
+    while(length >= 3 * LONG)
+    {
+      value = interleaved(LONG_SHIFT, value, data, LONG);
+      data += 3 * LONG;
+      length -= 3 * LONG;
+    }
+
+    while(length >= 3 * SHORT)
+    {
+      value = interleaved(SHORT_SHIFT, value, data, SHORT);
+      data += 3 * SHORT;
+      length -= 3 * SHORT;
+    }
+
+    while(length >= 8)
+    {
+      std::uint64_t word;
+      std::memcpy(&word, data, 8);
+      value = _mm_crc32_u64(value, word);
+      data += 8;
+      length -= 8;
+    }
+
+    auto result = static_cast<std::uint32_t>(value);
+    while(length-- != 0)
+    {
+      result = _mm_crc32_u8(result, *data++);
+    }
+
+    return result;
+  }
+}
+
+#endif // CRC32C_SIMD_KERNELS
+
+//----------------------------------------------------------------
+CRC32C::CRC32C()
+: CRC32{}
+{
+}
+
+//----------------------------------------------------------------
+void CRC32C::finalize()
+{
+  m_crc = ~updateTable(TABLE, m_crc, m_buffer, m_bufferLength);
+}
+
+//----------------------------------------------------------------
+void CRC32C::process_blocks(const unsigned char *blocks, const unsigned long long number)
+{
+#ifdef CRC32C_SIMD_KERNELS
+  static const bool useSSE42 = CPUFeatures::hasSSE42();
+
+  if(useSSE42)
+  {
+    m_crc = updateSSE42(m_crc, blocks, number * 64);
+    return;
+  }
+#endif
+
+  m_crc = updateTable(TABLE, m_crc, blocks, number * 64);
+}
@@ -0,0 +1,60 @@
+/*
+ File: CRC32C.h
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HASH_CRC32C_H_
+#define HASH_CRC32C_H_
+
+// Project
+#include <hash/CRC32.h>
+
+/** \class CRC32C
+ * \brief Implements the Castagnoli cyclic redundancy check of 32 bits. Uses the SSE4.2 crc32
+ *        instruction on three interleaved streams when the processor supports it.
+ *
+ */
+class CRC32C
+: public CRC32
+{
+  public:
+    /** \brief CRC32C class constructor.
+     *
+     */
+    CRC32C();
+
+    /** \brief CRC32C class virtual destructor.
+     *
+     */
+    virtual ~CRC32C()
+    {};
+
+    virtual const QString name() const override
+    { return QString("CRC32C"); }
+
+    virtual Algorithms::Id algorithm() const override
+    { return Algorithms::Id::CRC32C; }
+
+    virtual void finalize() override;
+
+  private:
+    static const Table TABLE; /** lookup tables of the reflected Castagnoli polynomial. */
+
+    virtual void process_blocks(const unsigned char *blocks, const unsigned long long number) override;
+};
+
+#endif // HASH_CRC32C_H_
@@ -0,0 +1,202 @@
+/*
+ File: KangarooTwelve.cpp
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Project
+#include <hash/KangarooTwelve.h>
+#include <hash/KeccakKernels.h>
+
+// Qt
+#include <QThreadPool>
+#include <QSemaphore>
+
+// C++
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+/** Rate of the TurboSHAKE128 sponges in bytes. */
+static const int RATE = 168;
+
+/** Rounds of the permutation. */
+static const int ROUNDS = 12;
+
+/** Length of the chaining values of the leaves in bytes. */
+static const int CV_LENGTH = 32;
+
+/** Maximum number of leaves of each batch, their chaining values are absorbed together. */
+static const unsigned long long BATCH_LEAVES = 1024;
+
+/** Minimum number of leaves hashed by each thread of the pool, 128 KiB. */
+static const unsigned long long PARALLEL_LEAVES = 16;
+
+//----------------------------------------------------------------
+KangarooTwelve::KangarooTwelve()
+: Keccak{RATE, 0x07, 32, ROUNDS}
+, m_pool{nullptr}
+{
+  reset();
+}
+
+//----------------------------------------------------------------
+void KangarooTwelve::reset()
+{
+  Keccak::reset();
+
+  m_tree       = false;
+  m_leaves     = 0;
+  m_leafLength = 0;
+}
+
+//----------------------------------------------------------------
+void KangarooTwelve::update(const unsigned char *data, unsigned long long length)
+{
+  // the first chunk is absorbed by the final node, that is also the only node of short messages.
+  if(!m_tree)
+  {
+    const auto bytes = std::min(static_cast<unsigned long long>(CHUNK_LENGTH - m_leafLength), length);
+    Keccak::update(data, bytes);
+    m_leafLength += bytes;
+    data += bytes;
+    length -= bytes;
+
+    if(length == 0) return;
+
+    // the chaining values of the leaves follow the first chunk.
+    const unsigned char separator[8] = { 0x03 };
+    Keccak::update(separator, sizeof(separator));
+
+    m_tree       = true;
+    m_leafLength = 0;
+  }
+
+  if(m_leafLength > 0)
+  {
+    const auto bytes = std::min(static_cast<unsigned long long>(CHUNK_LENGTH - m_leafLength), length);
+    std::memcpy(m_leaf + m_leafLength, data, bytes);
+    m_leafLength += bytes;
+    data += bytes;
+    length -= bytes;
+
+    if(m_leafLength < CHUNK_LENGTH) return;
+
+    hashLeaves(m_leaf, 1);
+    m_leafLength = 0;
+  }
+
+  const auto leaves = length / CHUNK_LENGTH;
+  if(leaves > 0)
+  {
+    hashLeaves(data, leaves);
+    data += leaves * CHUNK_LENGTH;
+    length -= leaves * CHUNK_LENGTH;
+  }
+
+  if(length > 0)
+  {
+    std::memcpy(m_leaf, data, length);
+    m_leafLength = length;
+  }
+}
+
+//----------------------------------------------------------------
+void KangarooTwelve::finalize()
+{
+  // the encoding of the length of the empty customization string.
+  const unsigned char zero = 0;
+  update(&zero, 1);
+
+  if(!m_tree)
+  {
+    pad(0x07);
+    return;
+  }
+
+  if(m_leafLength > 0)
+  {
+    unsigned char cv[CV_LENGTH];
+    KeccakKernels::hashMany(m_leaf, CHUNK_LENGTH, 1, m_leafLength, RATE, ROUNDS, 0x0B, CV_LENGTH, cv);
+    Keccak::update(cv, sizeof(cv));
+    ++m_leaves;
+  }
+
+  // number of leaves in big endian without leading zeroes, its length in bytes and 0xFFFF.
+  unsigned char encoding[11];
+  int bytes = 0;
+  for(auto value = m_leaves; value != 0; value >>= 8)
+  {
+    ++bytes;
+  }
+
+  for(int i = 0; i < bytes; ++i)
+  {
+    encoding[i] = static_cast<unsigned char>(m_leaves >> (8 * (bytes - 1 - i)));
+  }
+  encoding[bytes]     = bytes;
+  encoding[bytes + 1] = 0xFF;
+  encoding[bytes + 2] = 0xFF;
+
+  Keccak::update(encoding, bytes + 3);
+  pad(0x06);
+}
+
+//----------------------------------------------------------------
+void KangarooTwelve::hashLeaves(const unsigned char *data, const unsigned long long number)
+{
+  std::vector<unsigned char> cvs(std::min(number, BATCH_LEAVES) * CV_LENGTH);
+
+  for(unsigned long long done = 0; done < number;)
+  {
+    const auto leaves = std::min(number - done, BATCH_LEAVES);
+    const auto input  = data + done * CHUNK_LENGTH;
+
+    // the batch is divided between the threads of the pool, the last part is hashed in the
+    // calling thread and so are the parts that don't find a free thread.
+    const auto threads = m_pool ? static_cast<unsigned long long>(m_pool->maxThreadCount()) + 1 : 1;
+    const auto parts   = std::max(1ULL, std::min(threads, leaves / PARALLEL_LEAVES));
+    const auto perPart = (leaves + parts - 1) / parts;
+
+    QSemaphore finished;
+    int started = 0;
+
+    for(unsigned long long first = 0; first < leaves; first += perPart)
+    {
+      const auto count = std::min(perPart, leaves - first);
+      auto hashPart = [input, first, count, &cvs]()
+      {
+        KeccakKernels::hashMany(input + first * CHUNK_LENGTH, CHUNK_LENGTH, count, CHUNK_LENGTH, RATE, ROUNDS, 0x0B, CV_LENGTH, cvs.data() + first * CV_LENGTH);
+      };
+
+      const auto last = (first + count == leaves);
+      if(!last && m_pool->tryStart([&finished, hashPart]() { hashPart(); finished.release(); }))
+      {
+        ++started;
+      }
+      else
+      {
+        hashPart();
+      }
+    }
+
+    finished.acquire(started);
+
+    Keccak::update(cvs.data(), leaves * CV_LENGTH);
+    m_leaves += leaves;
+    done += leaves;
+  }
+}
@@ -0,0 +1,87 @@
+/*
+ File: KangarooTwelve.h
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HASH_KANGAROOTWELVE_H_
+#define HASH_KANGAROOTWELVE_H_
+
+// Project
+#include <hash/Keccak.h>
+
+class QThreadPool;
+
+/** \class KangarooTwelve
+ * \brief Implements the KangarooTwelve hash of 256 bits, without customization string. The
+ *        message after the first 8192 bytes is divided in leaves of 8192 bytes whose chaining
+ *        values are absorbed by the final node. The leaves of large updates are hashed at the
+ *        same time with the SIMD kernels and can be hashed by the threads of a pool.
+ *
+ */
+class KangarooTwelve
+: public Keccak
+{
+  public:
+    /** \brief KangarooTwelve class constructor.
+     *
+     */
+    KangarooTwelve();
+
+    /** \brief KangarooTwelve class virtual destructor.
+     *
+     */
+    virtual ~KangarooTwelve()
+    {};
+
+    virtual const QString name() const override
+    { return QString("K12"); }
+
+    virtual Algorithms::Id algorithm() const override
+    { return Algorithms::Id::K12; }
+
+    virtual void reset() override;
+
+    virtual void update(const unsigned char *data, const unsigned long long length) override;
+
+    virtual void finalize() override;
+
+    /** \brief Sets the pool of threads used to hash the leaves of large updates. The pool
+     * must exist while the hash is being updated.
+     * \param[in] pool thread pool or nullptr to hash the leaves in the calling thread.
+     *
+     */
+    void setThreadPool(QThreadPool *pool)
+    { m_pool = pool; }
+
+    static const int CHUNK_LENGTH = 8192; /** length of the first chunk and the leaves. */
+
+  private:
+    /** \brief Hashes complete leaves and absorbs their chaining values in the final node.
+     * \param[in] data leaves data.
+     * \param[in] number number of leaves.
+     *
+     */
+    void hashLeaves(const unsigned char *data, const unsigned long long number);
+
+    bool               m_tree;               /** true if the message is longer than the first chunk. */
+    unsigned long long m_leaves;             /** number of leaves absorbed in the final node.        */
+    unsigned char      m_leaf[CHUNK_LENGTH]; /** data of the current chunk not hashed yet.           */
+    int                m_leafLength;         /** length of the data in the current chunk.            */
+    QThreadPool       *m_pool;               /** pool for the leaves or nullptr if none.             */
+};
+
+#endif // HASH_KANGAROOTWELVE_H_
@@ -0,0 +1,98 @@
+/*
+ File: Keccak.cpp
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Project
+#include <hash/Keccak.h>
+#include <hash/KeccakKernels.h>
+
+// Qt
+#include <QStringList>
+
+// C++
+#include <cstring>
+
+//----------------------------------------------------------------
+Keccak::Keccak(const int rate, const unsigned char suffix, const int outputLength, const int rounds)
+: Hash          {}
+, m_rate        {rate}
+, m_suffix      {suffix}
+, m_outputLength{outputLength}
+, m_rounds      {rounds}
+{
+  reset();
+}
+
+//----------------------------------------------------------------
+const QString Keccak::value() const
+{
+  QStringList words;
+  for(int i = 0; i < m_outputLength / 4; ++i)
+  {
+    words << QString::fromLatin1(QByteArray(reinterpret_cast<const char *>(m_hash + 4 * i), 4).toHex());
+  }
+
+  return words.join(' ');
+}
+
+//----------------------------------------------------------------
+void Keccak::reset()
+{
+  Hash::reset();
+
+  std::memset(m_state, 0, sizeof(m_state));
+  std::memset(m_hash, 0, sizeof(m_hash));
+}
+
+//----------------------------------------------------------------
+void Keccak::finalize()
+{
+  pad(m_suffix);
+}
+
+//----------------------------------------------------------------
+void Keccak::pad(const unsigned char suffix)
+{
+  // pad10*1 after the domain separation bits.
+  std::memset(m_buffer + m_bufferLength, 0, m_rate - m_bufferLength);
+  m_buffer[m_bufferLength] ^= suffix;
+  m_buffer[m_rate - 1] ^= 0x80;
+
+  process_blocks(m_buffer, 1);
+
+  // the rate of every variant is larger than its output.
+  std::memcpy(m_hash, m_state, m_outputLength);
+}
+
+//----------------------------------------------------------------
+void Keccak::process_blocks(const unsigned char *blocks, const unsigned long long number)
+{
+  const int lanes = m_rate / 8;
+
+  for(unsigned long long i = 0; i < number; ++i, blocks += m_rate)
+  {
+    for(int lane = 0; lane < lanes; ++lane)
+    {
+      std::uint64_t word;
+      std::memcpy(&word, blocks + 8 * lane, 8);
+      m_state[lane] ^= word;
+    }
+
+    KeccakKernels::permute(m_state, m_rounds);
+  }
+}
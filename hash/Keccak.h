@@ -0,0 +1,82 @@
+/*
+ File: Keccak.h
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HASH_KECCAK_H_
+#define HASH_KECCAK_H_
+
+// Project
+#include <Hash.h>
+
+// C++
+#include <cstdint>
+
+/** \class Keccak
+ * \brief Base class of the SHA-3 family, a sponge over the Keccak-f[1600] permutation. The
+ *        block size is the rate of the sponge, that depends on the capacity of each variant.
+ *
+ */
+class Keccak
+: public Hash
+{
+  public:
+    /** \brief Keccak class virtual destructor.
+     *
+     */
+    virtual ~Keccak()
+    {};
+
+    virtual const int blockSize() const override
+    { return m_rate; }
+
+    virtual const QString value() const override;
+
+    virtual void reset() override;
+
+    virtual void finalize() override;
+
+  protected:
+    /** \brief Keccak class constructor.
+     * \param[in] rate rate of the sponge in bytes.
+     * \param[in] suffix domain separation bits, followed by the first bit of the padding.
+     * \param[in] outputLength length of the hash value in bytes.
+     * \param[in] rounds number of rounds of the permutation.
+     *
+     */
+    Keccak(const int rate, const unsigned char suffix, const int outputLength, const int rounds = 24);
+
+    /** \brief Absorbs the buffered data with the padding and computes the hash value.
+     * \param[in] suffix domain separation bits, followed by the first bit of the padding.
+     *
+     */
+    void pad(const unsigned char suffix);
+
+  private:
+    friend class KeccakMultiBuffer;
+
+    virtual void process_blocks(const unsigned char *blocks, const unsigned long long number) override;
+
+    const int           m_rate;         /** rate of the sponge in bytes.          */
+    const unsigned char m_suffix;       /** domain separation and padding bits.   */
+    const int           m_outputLength; /** length of the hash value in bytes.    */
+    const int           m_rounds;       /** number of rounds of the permutation.  */
+    std::uint64_t       m_state[25];    /** state lanes.                          */
+    unsigned char       m_hash[64];     /** hash value.                           */
+};
+
+#endif // HASH_KECCAK_H_
@@ -0,0 +1,615 @@
+/*
+ File: KeccakKernels.cpp
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Project
+#include <hash/KeccakKernels.h>
+#include <CPUFeatures.h>
+
+// C++
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define KECCAK_SIMD_KERNELS
+#include <immintrin.h>
+#endif
+
+/** Round constants of the iota step. */
+static const std::uint64_t ROUND_CONSTANTS[24] =
+{
+  0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808AULL, 0x8000000080008000ULL,
+  0x000000000000808BULL, 0x0000000080000001ULL, 0x8000000080008081ULL, 0x8000000000008009ULL,
+  0x000000000000008AULL, 0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000AULL,
+  0x000000008000808BULL, 0x800000000000008BULL, 0x8000000000008089ULL, 0x8000000000008003ULL,
+  0x8000000000008002ULL, 0x8000000000000080ULL, 0x000000000000800AULL, 0x800000008000000AULL,
+  0x8000000080008081ULL, 0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+};
+
+/** Lanes kept complemented during the permutation, it saves most of the NOT operations of the chi step. */
+static const int COMPLEMENTED[6] = { 1, 2, 8, 12, 17, 20 };
+
+/** \brief Rotational shift to the left of the 64 bits value.
+ * \param[in] x value.
+ * \param[in] n number of bits.
+ *
+ */
+static inline std::uint64_t rotl(const std::uint64_t x, const int n)
+{
+  return (x << n) | (x >> (64 - n));
+}
+
+/** \brief Computes one round from the state a into the state e, with the lanes 1, 2, 8, 12, 17
+ * and 20 complemented in both states. The lanes are named by row (b, g, k, m, s) and column (a, e, i, o, u).
+ * \param[in] a input state.
+ * \param[out] e output state.
+ * \param[in] constant round constant.
+ *
+ */
+static inline __attribute__((always_inline)) void round(const std::uint64_t *a, std::uint64_t *e, const std::uint64_t constant)
+{
+  // theta
+  const auto ca = a[0] ^ a[5] ^ a[10] ^ a[15] ^ a[20];
+  const auto ce = a[1] ^ a[6] ^ a[11] ^ a[16] ^ a[21];
+  const auto ci = a[2] ^ a[7] ^ a[12] ^ a[17] ^ a[22];
+  const auto co = a[3] ^ a[8] ^ a[13] ^ a[18] ^ a[23];
+  const auto cu = a[4] ^ a[9] ^ a[14] ^ a[19] ^ a[24];
+
+  const auto da = cu ^ rotl(ce, 1);
+  const auto de = ca ^ rotl(ci, 1);
+  const auto di = ce ^ rotl(co, 1);
+  const auto dO = ci ^ rotl(cu, 1);
+  const auto du = co ^ rotl(ca, 1);
+
+  // rho, pi, chi and iota, row by row.
+  auto ba = a[0] ^ da;
+  auto be = rotl(a[6] ^ de, 44);
+  auto bi = rotl(a[12] ^ di, 43);
+  auto bo = rotl(a[18] ^ dO, 21);
+  auto bu = rotl(a[24] ^ du, 14);
+  e[0] = ba ^ (be | bi) ^ constant;
+  e[1] = be ^ ((~bi) | bo);
+  e[2] = bi ^ (bo & bu);
+  e[3] = bo ^ (bu | ba);
+  e[4] = bu ^ (ba & be);
+
+  ba = rotl(a[3] ^ dO, 28);
+  be = rotl(a[9] ^ du, 20);
+  bi = rotl(a[10] ^ da, 3);
+  bo = rotl(a[16] ^ de, 45);
+  bu = rotl(a[22] ^ di, 61);
+  e[5] = ba ^ (be | bi);
+  e[6] = be ^ (bi & bo);
+  e[7] = bi ^ (bo | (~bu));
+  e[8] = bo ^ (bu | ba);
+  e[9] = bu ^ (ba & be);
+
+  ba = rotl(a[1] ^ de, 1);
+  be = rotl(a[7] ^ di, 6);
+  bi = rotl(a[13] ^ dO, 25);
+  bo = rotl(a[19] ^ du, 8);
+  bu = rotl(a[20] ^ da, 18);
+  e[10] = ba ^ (be | bi);
+  e[11] = be ^ (bi & bo);
+  e[12] = bi ^ ((~bo) & bu);
+  e[13] = (~bo) ^ (bu | ba);
+  e[14] = bu ^ (ba & be);
+
+  ba = rotl(a[4] ^ du, 27);
+  be = rotl(a[5] ^ da, 36);
+  bi = rotl(a[11] ^ de, 10);
+  bo = rotl(a[17] ^ di, 15);
+  bu = rotl(a[23] ^ dO, 56);
+  e[15] = ba ^ (be & bi);
+  e[16] = be ^ (bi | bo);
+  e[17] = bi ^ ((~bo) | bu);
+  e[18] = (~bo) ^ (bu & ba);
+  e[19] = bu ^ (ba | be);
+
+  ba = rotl(a[2] ^ di, 62);
+  be = rotl(a[8] ^ dO, 55);
+  bi = rotl(a[14] ^ du, 39);
+  bo = rotl(a[15] ^ da, 41);
+  bu = rotl(a[21] ^ de, 2);
+  e[20] = ba ^ ((~be) & bi);
+  e[21] = (~be) ^ (bi | bo);
+  e[22] = bi ^ (bo & bu);
+  e[23] = bo ^ (bu | ba);
+  e[24] = bu ^ (ba & be);
+}
+
+/** \brief Applies the last rounds of the permutation to the state, in pairs of rounds that
+ * swap the two copies of the state.
+ * \param[inout] state state lanes.
+ *
+ */
+template<int ROUNDS>
+static void permuteRounds(std::uint64_t state[25])
+{
+  std::uint64_t a[25], e[25];
+  std::memcpy(a, state, sizeof(a));
+
+  for(auto lane: COMPLEMENTED) a[lane] = ~a[lane];
+
+#pragma GCC unroll 12
+  for(int i = 24 - ROUNDS; i < 24; i += 2)
+  {
+    round(a, e, ROUND_CONSTANTS[i]);
+    round(e, a, ROUND_CONSTANTS[i + 1]);
+  }
+
+  for(auto lane: COMPLEMENTED) a[lane] = ~a[lane];
+
+  std::memcpy(state, a, sizeof(a));
+}
+
+/** \brief Absorbs the input with the padding and stores the output.
+ * \param[in] input input data.
+ * \param[in] length length of the input in bytes.
+ * \param[in] rate rate of the sponge in bytes.
+ * \param[in] rounds number of rounds of the permutation.
+ * \param[in] suffix domain separation and padding bits.
+ * \param[in] outputLength length of the output in bytes.
+ * \param[out] out output.
+ *
+ */
+static void hashOne(const unsigned char *input, std::size_t length, const int rate, const int rounds,
+                    const unsigned char suffix, const int outputLength, unsigned char *out)
+{
+  std::uint64_t state[25] = {};
+  unsigned char last[200] = {};
+
+  for(; length >= static_cast<std::size_t>(rate); length -= rate, input += rate)
+  {
+    for(int i = 0; i < rate / 8; ++i)
+    {
+      std::uint64_t word;
+      std::memcpy(&word, input + 8 * i, 8);
+      state[i] ^= word;
+    }
+
+    KeccakKernels::permute(state, rounds);
+  }
+
+  std::memcpy(last, input, length);
+  last[length] ^= suffix;
+  last[rate - 1] ^= 0x80;
+
+  for(int i = 0; i < rate / 8; ++i)
+  {
+    std::uint64_t word;
+    std::memcpy(&word, last + 8 * i, 8);
+    state[i] ^= word;
+  }
+
+  KeccakKernels::permute(state, rounds);
+
+  std::memcpy(out, state, outputLength);
+}
+
+#ifdef KECCAK_SIMD_KERNELS
+
+/** Rotation offsets of the rho step, in lane order. */
+static const int RHO[25] =
+{
+   0,  1, 62, 28, 27,
+  36, 44,  6, 55, 20,
+   3, 10, 43, 25, 39,
+  41, 45, 15, 21,  8,
+  18,  2, 61, 56, 14
+};
+
+/** \brief Rotational shift to the left of the 64 bits values.
+ * \param[in] x values.
+ * \param[in] n number of bits.
+ *
+ */
+__attribute__((target("avx2"), always_inline))
+static inline __m256i ROTL(const __m256i x, const int n)
+{
+  if(n == 0) return x;
+
+  // the byte rotations are a single shuffle.
+  if(n == 8)
+  {
+    return _mm256_shuffle_epi8(x, _mm256_set_epi8(14,13,12,11,10,9,8,15, 6,5,4,3,2,1,0,7,
+                                                  14,13,12,11,10,9,8,15, 6,5,4,3,2,1,0,7));
+  }
+  if(n == 56)
+  {
+    return _mm256_shuffle_epi8(x, _mm256_set_epi8(8,15,14,13,12,11,10,9, 0,7,6,5,4,3,2,1,
+                                                  8,15,14,13,12,11,10,9, 0,7,6,5,4,3,2,1));
+  }
+
+  return _mm256_or_si256(_mm256_slli_epi64(x, n), _mm256_srli_epi64(x, 64 - n));
+}
+
+/** \brief Applies the last rounds of the permutation to four states.
+ * \param[inout] s state lanes, one register per lane of the state and one element per state.
+ * \param[in] rounds number of rounds.
+ *
+ */
+__attribute__((target("avx2")))
+static void permute4AVX2(__m256i s[25], const int rounds)
+{
+  for(int round = 24 - rounds; round < 24; ++round)
+  {
+    __m256i c[5], b[25];
+
+    // theta
+#pragma GCC unroll 5
+    for(int x = 0; x < 5; ++x)
+    {
+      c[x] = _mm256_xor_si256(_mm256_xor_si256(s[x], s[x + 5]), _mm256_xor_si256(_mm256_xor_si256(s[x + 10], s[x + 15]), s[x + 20]));
+    }
+
+#pragma GCC unroll 5
+    for(int x = 0; x < 5; ++x)
+    {
+      const auto d = _mm256_xor_si256(c[(x + 4) % 5], ROTL(c[(x + 1) % 5], 1));
+#pragma GCC unroll 5
+      for(int y = 0; y < 25; y += 5)
+      {
+        s[x + y] = _mm256_xor_si256(s[x + y], d);
+      }
+    }
+
+    // rho and pi
+#pragma GCC unroll 5
+    for(int x = 0; x < 5; ++x)
+    {
+#pragma GCC unroll 5
+      for(int y = 0; y < 5; ++y)
+      {
+        b[y + 5 * ((2 * x + 3 * y) % 5)] = ROTL(s[x + 5 * y], RHO[x + 5 * y]);
+      }
+    }
+
+    // chi
+#pragma GCC unroll 5
+    for(int y = 0; y < 25; y += 5)
+    {
+#pragma GCC unroll 5
+      for(int x = 0; x < 5; ++x)
+      {
+        s[x + y] = _mm256_xor_si256(b[x + y], _mm256_andnot_si256(b[(x + 1) % 5 + y], b[(x + 2) % 5 + y]));
+      }
+    }
+
+    // iota
+    s[0] = _mm256_xor_si256(s[0], _mm256_set1_epi64x(static_cast<long long>(ROUND_CONSTANTS[round])));
+  }
+}
+
+/** \brief Absorbs one block of each of four states, see KeccakKernels::absorb4().
+ *
+ */
+__attribute__((target("avx2")))
+static void absorb4AVX2(std::uint64_t state[25][4], const unsigned char *const blocks[4], const int rate)
+{
+  __m256i s[25];
+  for(int i = 0; i < 25; ++i)
+  {
+    s[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(state[i]));
+  }
+
+  for(int i = 0; i < rate / 8; ++i)
+  {
+    std::uint64_t words[4];
+    for(int lane = 0; lane < 4; ++lane)
+    {
+      std::memcpy(&words[lane], blocks[lane] + 8 * i, 8);
+    }
+
+    s[i] = _mm256_xor_si256(s[i], _mm256_loadu_si256(reinterpret_cast<const __m256i *>(words)));
+  }
+
+  permute4AVX2(s, 24);
+
+  for(int i = 0; i < 25; ++i)
+  {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(state[i]), s[i]);
+  }
+}
+
+// GCC 12 warns about the undefined vectors inside its own AVX-512 rotate and gather intrinsics.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+/** \brief Applies the last rounds of the permutation to eight states. The rotations and the
+ * three inputs logic functions are single instructions.
+ * \param[inout] s state lanes, one register per lane of the state and one element per state.
+ * \param[in] rounds number of rounds.
+ *
+ */
+__attribute__((target("avx512f")))
+static void permute8AVX512(__m512i s[25], const int rounds)
+{
+  for(int round = 24 - rounds; round < 24; ++round)
+  {
+    __m512i c[5], b[25];
+
+    // theta, 0x96 is the xor of the three inputs.
+#pragma GCC unroll 5
+    for(int x = 0; x < 5; ++x)
+    {
+      c[x] = _mm512_ternarylogic_epi64(_mm512_ternarylogic_epi64(s[x], s[x + 5], s[x + 10], 0x96), s[x + 15], s[x + 20], 0x96);
+    }
+
+#pragma GCC unroll 5
+    for(int x = 0; x < 5; ++x)
+    {
+      const auto d = _mm512_xor_si512(c[(x + 4) % 5], _mm512_rolv_epi64(c[(x + 1) % 5], _mm512_set1_epi64(1)));
+#pragma GCC unroll 5
+      for(int y = 0; y < 25; y += 5)
+      {
+        s[x + y] = _mm512_xor_si512(s[x + y], d);
+      }
+    }
+
+    // rho and pi
+#pragma GCC unroll 5
+    for(int x = 0; x < 5; ++x)
+    {
+#pragma GCC unroll 5
+      for(int y = 0; y < 5; ++y)
+      {
+        b[y + 5 * ((2 * x + 3 * y) % 5)] = _mm512_rolv_epi64(s[x + 5 * y], _mm512_set1_epi64(RHO[x + 5 * y]));
+      }
+    }
+
+    // chi, 0xD2 is a ^ (~b & c).
+#pragma GCC unroll 5
+    for(int y = 0; y < 25; y += 5)
+    {
+#pragma GCC unroll 5
+      for(int x = 0; x < 5; ++x)
+      {
+        s[x + y] = _mm512_ternarylogic_epi64(b[x + y], b[(x + 1) % 5 + y], b[(x + 2) % 5 + y], 0xD2);
+      }
+    }
+
+    // iota
+    s[0] = _mm512_xor_si512(s[0], _mm512_set1_epi64(static_cast<long long>(ROUND_CONSTANTS[round])));
+  }
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+/** \brief Absorbs one block of each of four states, the blocks are at the given offsets.
+ * \param[inout] s state lanes.
+ * \param[in] base address of the first block.
+ * \param[in] offsets offsets of the blocks from the base address.
+ * \param[in] rate rate of the sponges in bytes.
+ * \param[in] rounds number of rounds.
+ *
+ */
+__attribute__((target("avx2")))
+static inline void absorbBlock4AVX2(__m256i s[25], const unsigned char *base, const __m256i offsets, const int rate, const int rounds)
+{
+  for(int i = 0; i < rate / 8; ++i)
+  {
+    const auto words = _mm256_i64gather_epi64(reinterpret_cast<const long long *>(base + 8 * i), offsets, 1);
+    s[i] = _mm256_xor_si256(s[i], words);
+  }
+
+  permute4AVX2(s, rounds);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+/** \brief Absorbs one block of each of eight states, the blocks are at the given offsets.
+ * \param[inout] s state lanes.
+ * \param[in] base address of the first block.
+ * \param[in] offsets offsets of the blocks from the base address.
+ * \param[in] rate rate of the sponges in bytes.
+ * \param[in] rounds number of rounds.
+ *
+ */
+__attribute__((target("avx512f")))
+static inline void absorbBlock8AVX512(__m512i s[25], const unsigned char *base, const __m512i offsets, const int rate, const int rounds)
+{
+  for(int i = 0; i < rate / 8; ++i)
+  {
+    const auto words = _mm512_i64gather_epi64(offsets, base + 8 * i, 1);
+    s[i] = _mm512_xor_si512(s[i], words);
+  }
+
+  permute8AVX512(s, rounds);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+/** \brief Hashes four inputs at the same time, see KeccakKernels::hashMany().
+ *
+ */
+__attribute__((target("avx2")))
+static void hash4AVX2(const unsigned char *inputs, const std::size_t stride, std::size_t length, const int rate,
+                      const int rounds, const unsigned char suffix, const int outputLength, unsigned char *out)
+{
+  const auto offsets = _mm256_set_epi64x(3 * stride, 2 * stride, stride, 0);
+  alignas(32) unsigned char last[4][200] = {};
+  __m256i s[25];
+
+  for(int i = 0; i < 25; ++i)
+  {
+    s[i] = _mm256_setzero_si256();
+  }
+
+  for(; length >= static_cast<std::size_t>(rate); length -= rate, inputs += rate)
+  {
+    absorbBlock4AVX2(s, inputs, offsets, rate, rounds);
+  }
+
+  for(int lane = 0; lane < 4; ++lane)
+  {
+    std::memcpy(last[lane], inputs + lane * stride, length);
+    last[lane][length] ^= suffix;
+    last[lane][rate - 1] ^= 0x80;
+  }
+
+  absorbBlock4AVX2(s, last[0], _mm256_set_epi64x(600, 400, 200, 0), rate, rounds);
+
+  alignas(32) std::uint64_t words[4];
+  for(int i = 0; i < outputLength / 8; ++i)
+  {
+    _mm256_store_si256(reinterpret_cast<__m256i *>(words), s[i]);
+    for(int lane = 0; lane < 4; ++lane)
+    {
+      std::memcpy(out + lane * outputLength + 8 * i, &words[lane], 8);
+    }
+  }
+}
+
+/** \brief Hashes eight inputs at the same time, see KeccakKernels::hashMany().
+ *
+ */
+__attribute__((target("avx512f")))
+static void hash8AVX512(const unsigned char *inputs, const std::size_t stride, std::size_t length, const int rate,
+                        const int rounds, const unsigned char suffix, const int outputLength, unsigned char *out)
+{
+  const auto offsets = _mm512_set_epi64(7 * stride, 6 * stride, 5 * stride, 4 * stride, 3 * stride, 2 * stride, stride, 0);
+  alignas(64) unsigned char last[8][200] = {};
+  __m512i s[25];
+
+  for(int i = 0; i < 25; ++i)
+  {
+    s[i] = _mm512_setzero_si512();
+  }
+
+  for(; length >= static_cast<std::size_t>(rate); length -= rate, inputs += rate)
+  {
+    absorbBlock8AVX512(s, inputs, offsets, rate, rounds);
+  }
+
+  for(int lane = 0; lane < 8; ++lane)
+  {
+    std::memcpy(last[lane], inputs + lane * stride, length);
+    last[lane][length] ^= suffix;
+    last[lane][rate - 1] ^= 0x80;
+  }
+
+  absorbBlock8AVX512(s, last[0], _mm512_set_epi64(1400, 1200, 1000, 800, 600, 400, 200, 0), rate, rounds);
+
+  alignas(64) std::uint64_t words[8];
+  for(int i = 0; i < outputLength / 8; ++i)
+  {
+    _mm512_store_si512(words, s[i]);
+    for(int lane = 0; lane < 8; ++lane)
+    {
+      std::memcpy(out + lane * outputLength + 8 * i, &words[lane], 8);
+    }
+  }
+}
+
+#endif // KECCAK_SIMD_KERNELS
+
+//----------------------------------------------------------------
+int KeccakKernels::degree()
+{
+#ifdef KECCAK_SIMD_KERNELS
+  static const int value = CPUFeatures::hasAVX512() ? 8 : (CPUFeatures::hasAVX2() ? 4 : 1);
+
+  return value;
+#else
+  return 1;
+#endif
+}
+
+//----------------------------------------------------------------
+void KeccakKernels::permute(std::uint64_t state[25], const int rounds)
+{
+  if(rounds == 12)
+  {
+    permuteRounds<12>(state);
+  }
+  else
+  {
+    permuteRounds<24>(state);
+  }
+}
+
+//----------------------------------------------------------------
+void KeccakKernels::absorb4(std::uint64_t state[25][4], const unsigned char *const blocks[4], const int rate)
+{
+#ifdef KECCAK_SIMD_KERNELS
+  if(degree() >= 4)
+  {
+    absorb4AVX2(state, blocks, rate);
+    return;
+  }
+#endif
+
+  for(int lane = 0; lane < 4; ++lane)
+  {
+    std::uint64_t laneState[25];
+    for(int i = 0; i < 25; ++i)
+    {
+      laneState[i] = state[i][lane];
+    }
+
+    for(int i = 0; i < rate / 8; ++i)
+    {
+      std::uint64_t word;
+      std::memcpy(&word, blocks[lane] + 8 * i, 8);
+      laneState[i] ^= word;
+    }
+
+    permute(laneState, 24);
+
+    for(int i = 0; i < 25; ++i)
+    {
+      state[i][lane] = laneState[i];
+    }
+  }
+}
+
+//----------------------------------------------------------------
+void KeccakKernels::hashMany(const unsigned char *inputs, const std::size_t stride, std::size_t number, const std::size_t length,
+                             const int rate, const int rounds, const unsigned char suffix, const int outputLength, unsigned char *out)
+{
+#ifdef KECCAK_SIMD_KERNELS
+  // the widest kernel first, the remaining inputs are hashed by the narrower ones.
+  const auto width = degree();
+
+  for(; width >= 8 && number >= 8; number -= 8, inputs += 8 * stride, out += 8 * outputLength)
+  {
+    hash8AVX512(inputs, stride, length, rate, rounds, suffix, outputLength, out);
+  }
+
+  for(; width >= 4 && number >= 4; number -= 4, inputs += 4 * stride, out += 4 * outputLength)
+  {
+    hash4AVX2(inputs, stride, length, rate, rounds, suffix, outputLength, out);
+  }
+#endif
+
+  for(; number > 0; --number, inputs += stride, out += outputLength)
+  {
+    hashOne(inputs, length, rate, rounds, suffix, outputLength, out);
+  }
+}
@@ -0,0 +1,71 @@
+/*
+ File: KeccakKernels.h
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HASH_KECCAKKERNELS_H_
+#define HASH_KECCAKKERNELS_H_
+
+// C++
+#include <cstddef>
+#include <cstdint>
+
+/** Keccak-p[1600] permutations, the SIMD versions permute several states at the same time. */
+namespace KeccakKernels
+{
+  /** Maximum number of states permuted at the same time by the kernels. */
+  const int MAX_DEGREE = 8;
+
+  /** \brief Returns the number of states permuted at the same time by the best kernel
+   * supported by the processor.
+   *
+   */
+  int degree();
+
+  /** \brief Applies the last rounds of the Keccak-f[1600] permutation to the state.
+   * \param[inout] state state lanes.
+   * \param[in] rounds number of rounds, 24 for the SHA-3 functions and 12 for KangarooTwelve.
+   *
+   */
+  void permute(std::uint64_t state[25], const int rounds);
+
+  /** \brief Absorbs one block of each of four states with the 24 rounds permutation.
+   * \param[inout] state state lanes, one row per lane and one column per state.
+   * \param[in] blocks data block of each state.
+   * \param[in] rate rate of the sponges in bytes.
+   *
+   */
+  void absorb4(std::uint64_t state[25][4], const unsigned char *const blocks[4], const int rate);
+
+  /** \brief Hashes several inputs of the same length placed at regular intervals in memory
+   * and stores their outputs contiguously.
+   * \param[in] inputs data of the first input.
+   * \param[in] stride distance in bytes between the inputs.
+   * \param[in] number number of inputs.
+   * \param[in] length length of each input in bytes.
+   * \param[in] rate rate of the sponges in bytes.
+   * \param[in] rounds number of rounds of the permutation.
+   * \param[in] suffix domain separation bits, followed by the first bit of the padding.
+   * \param[in] outputLength length of each output in bytes, a multiple of 8 not greater than the rate.
+   * \param[out] out outputs.
+   *
+   */
+  void hashMany(const unsigned char *inputs, const std::size_t stride, std::size_t number, const std::size_t length,
+                const int rate, const int rounds, const unsigned char suffix, const int outputLength, unsigned char *out);
+}
+
+#endif // HASH_KECCAKKERNELS_H_
@@ -0,0 +1,126 @@
+/*
+ File: KeccakMultiBuffer.cpp
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Project
+#include <hash/KeccakMultiBuffer.h>
+#include <hash/Keccak.h>
+#include <hash/KeccakKernels.h>
+
+//----------------------------------------------------------------
+bool KeccakMultiBuffer::isAvailable()
+{
+  return KeccakKernels::degree() >= LANES;
+}
+
+//----------------------------------------------------------------
+void KeccakMultiBuffer::update(Keccak *const hashes[], const unsigned char *const data[], const unsigned long long lengths[], const int number)
+{
+  int next = 0;
+
+  if(number > 0 && isAvailable())
+  {
+    // the idle lanes hash this block and their results are discarded.
+    static const unsigned char IDLE_BLOCK[168] = {};
+    std::uint64_t state[25][LANES];
+    const unsigned char *blocks[LANES];
+    int message[LANES];
+    unsigned long long offset[LANES];
+    const auto rate = hashes[0]->m_rate;
+
+    // returns the lane message to its hash object with the bytes that haven't been processed.
+    auto release = [&](const int lane)
+    {
+      auto hash = hashes[message[lane]];
+      for(int i = 0; i < 25; ++i)
+      {
+        hash->m_state[i] = state[i][lane];
+      }
+      hash->m_messageLength += offset[lane];
+      hash->update(data[message[lane]] + offset[lane], lengths[message[lane]] - offset[lane]);
+
+      message[lane] = -1;
+    };
+
+    for(int lane = 0; lane < LANES; ++lane)
+    {
+      message[lane] = -1;
+    }
+
+    while(true)
+    {
+      int active = 0;
+
+      for(int lane = 0; lane < LANES; ++lane)
+      {
+        // fill the empty lanes with the next messages that have at least one complete block.
+        while(message[lane] == -1 && next < number)
+        {
+          const auto hash = hashes[next];
+          if(hash->m_rate == rate && hash->m_rounds == 24 && hash->m_bufferLength == 0 && lengths[next] >= static_cast<unsigned long long>(rate))
+          {
+            message[lane] = next;
+            offset[lane]  = 0;
+            for(int i = 0; i < 25; ++i)
+            {
+              state[i][lane] = hash->m_state[i];
+            }
+          }
+          else
+          {
+            hash->update(data[next], lengths[next]);
+          }
+
+          ++next;
+        }
+
+        if(message[lane] != -1) ++active;
+      }
+
+      // a single lane is faster with the scalar permutation.
+      if(active < LANES / 2)
+      {
+        for(int lane = 0; lane < LANES; ++lane)
+        {
+          if(message[lane] != -1) release(lane);
+        }
+        break;
+      }
+
+      for(int lane = 0; lane < LANES; ++lane)
+      {
+        blocks[lane] = (message[lane] == -1) ? IDLE_BLOCK : data[message[lane]] + offset[lane];
+      }
+
+      KeccakKernels::absorb4(state, blocks, rate);
+
+      for(int lane = 0; lane < LANES; ++lane)
+      {
+        if(message[lane] == -1) continue;
+
+        offset[lane] += rate;
+        if(lengths[message[lane]] - offset[lane] < static_cast<unsigned long long>(rate)) release(lane);
+      }
+    }
+  }
+
+  for(; next < number; ++next)
+  {
+    hashes[next]->update(data[next], lengths[next]);
+  }
+}
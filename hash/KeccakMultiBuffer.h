@@ -0,0 +1,52 @@
+/*
+ File: KeccakMultiBuffer.h
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HASH_KECCAKMULTIBUFFER_H_
+#define HASH_KECCAKMULTIBUFFER_H_
+
+class Keccak;
+
+/** \class KeccakMultiBuffer
+ * \brief Computes the SHA-3 family hashes of several independent messages at once, each
+ *        message uses one of the 64 bits lanes of the AVX2 registers.
+ *
+ */
+class KeccakMultiBuffer
+{
+  public:
+    static const int LANES = 4; /** number of messages processed at once. */
+
+    /** \brief Returns true if the engine has been compiled and the processor supports it.
+     *
+     */
+    static bool isAvailable();
+
+    /** \brief Updates each hash with its message. The complete blocks are processed in parallel
+     * and the remaining bytes are buffered in the hash object, that must be finalized as usual.
+     * Only the hashes with the rate of the first one share the lanes, the rest are updated one by one.
+     * \param[in] hashes hash objects.
+     * \param[in] data messages.
+     * \param[in] lengths lengths of the messages in bytes.
+     * \param[in] number number of messages, can be greater than the number of lanes.
+     *
+     */
+    static void update(Keccak *const hashes[], const unsigned char *const data[], const unsigned long long lengths[], const int number);
+};
+
+#endif // HASH_KECCAKMULTIBUFFER_H_
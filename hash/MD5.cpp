@@ -27,7 +27,7 @@
 #include <QString>
 
 /* MD5 table : additive constants, abs(sin(j+1)) 0 =< j =< 63 */
-static const unsigned long MD5_CONSTANTS[64] =
+static const std::uint32_t MD5_CONSTANTS[64] =
 {
   0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
   0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
@@ -72,43 +72,42 @@ const int MD5::blockSize() const
 }
 
 //----------------------------------------------------------------
-const int MD5::bitsPerUnit() const
+void MD5::process_blocks(const unsigned char *blocks, const unsigned long long number)
 {
-  return 8;
+  for(unsigned long long i = 0; i < number; ++i)
+  {
+    process_block(blocks + (i * 64));
+  }
 }
 
 //----------------------------------------------------------------
-void MD5::update(const QByteArray &buffer, const unsigned long long message_length)
+void MD5::finalize()
 {
-  auto length = buffer.length();
+  auto length = m_bufferLength;
+  m_buffer[length++] = 0x80;
 
-  if (64 == length)
+  /* if length <= 56 there is space for message length, we process 1 block */
+  /* if not, we need to process two blocks                                 */
+  if (length > 56)
   {
-    process_block(reinterpret_cast<const unsigned char *>(buffer.constData()));
-    return;
+      std::memset(m_buffer + length, 0x00, 64 - length);
+      process_block(m_buffer);
+      length = 0;
   }
 
-  QByteArray finalBuffer{64,0};
-  std::memcpy(finalBuffer.data(), buffer.constData(), length);
-  finalBuffer[length++] = 0x80;
-
-  /* if length < 55 there is space for message length, we process 1 block */
-  /* if not, we need to process two blocks                                */
-  if (length >= 56)
-  {
-      process_block(reinterpret_cast<const unsigned char *>(finalBuffer.constData()));
-      std::memset(finalBuffer.data(), 0x00, 64);
-  }
+  std::memset(m_buffer + length, 0x00, 56 - length);
 
+  const auto bits = m_messageLength * 8;
   for (int loop = 0; loop < 8; loop++)
   {
-    finalBuffer[56+loop] = static_cast<unsigned char>(((message_length) >> (8 * loop)) & 0xFF);
+    m_buffer[56+loop] = static_cast<unsigned char>((bits >> (8 * loop)) & 0xFF);
   }
 
-  process_block(reinterpret_cast<const unsigned char *>(finalBuffer.constData()));
+  process_block(m_buffer);
+  m_bufferLength = 0;
 
   /* for reversing the byte order, MD5 is little-endian */
-  auto reverse = [] (unsigned long value)
+  auto reverse = [] (std::uint32_t value)
   {
     unsigned char a,b,c,d;
 
@@ -117,10 +116,10 @@ void MD5::update(const QByteArray &buffer, const unsigned long long message_leng
     c = (unsigned char)((value >>  8) & 0xFF);
     d = (unsigned char)(value & 0xFF);
 
-    value = (unsigned long)(d << 24);
-    value |= (unsigned long)(c << 16);
-    value |= (unsigned long)(b << 8);
-    value |= (unsigned long)a;
+    value = (std::uint32_t)(d << 24);
+    value |= (std::uint32_t)(c << 16);
+    value |= (std::uint32_t)(b << 8);
+    value |= (std::uint32_t)a;
 
     return value;
   };
@@ -143,11 +142,11 @@ const QString MD5::value() const
 //----------------------------------------------------------------
 void MD5::process_block(const unsigned char *char_block)
 {
-  unsigned long a, b, c, d,temp;
-  unsigned long long_block[16];
+  std::uint32_t a, b, c, d,temp;
+  std::uint32_t long_block[16];
   unsigned int loop;
 
-  auto Function = [](unsigned int loop, unsigned long x, unsigned long y, unsigned long z)
+  auto Function = [](unsigned int loop, std::uint32_t x, std::uint32_t y, std::uint32_t z)
   {
     if (loop < 16)
     {
@@ -172,19 +171,19 @@ void MD5::process_block(const unsigned char *char_block)
   };
 
   /* Rotational shift to the left */
-  auto ROTL = [](unsigned long x,  int n )
+  auto ROTL = [](std::uint32_t x,  int n )
   {
-    return ((x << n) | (( x & 0xFFFFFFFF ) >> ( 32 - n )));
+    return static_cast<std::uint32_t>((x << n) | (x >> (32 - n)));
   };
 
-  /* convert the block from unsigned char to unsigned long */
+  /* convert the block from unsigned char to 32 bits words  */
   /* MD5 is little-endian so we have to reverse bytes      */
   for (loop = 0; loop < 16; loop++)
   {
-    long_block[loop] = ((unsigned long) (char_block[(loop*4)]   <<  0)) |
-                       ((unsigned long) (char_block[(loop*4)+1] <<  8)) |
-                       ((unsigned long) (char_block[(loop*4)+2] << 16)) |
-                       ((unsigned long) (char_block[(loop*4)+3] << 24));
+    long_block[loop] = (static_cast<std::uint32_t>(char_block[(loop*4)])   <<  0) |
+                       (static_cast<std::uint32_t>(char_block[(loop*4)+1]) <<  8) |
+                       (static_cast<std::uint32_t>(char_block[(loop*4)+2]) << 16) |
+                       (static_cast<std::uint32_t>(char_block[(loop*4)+3]) << 24);
   }
 
   /* initialize working variables for this block */
@@ -215,6 +214,8 @@ void MD5::process_block(const unsigned char *char_block)
 //----------------------------------------------------------------
 void MD5::reset()
 {
+  Hash::reset();
+
   A = 0x67452301;
   B = 0xefcdab89;
   C = 0x98badcfe;
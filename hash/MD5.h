@@ -26,6 +26,9 @@
 // Qt
 #include <QObject>
 
+// C++
+#include <cstdint>
+
 /** \class MD5
  * \brief Implements the Message Digest Algorithm 5 of 128 bits.
  *
@@ -47,25 +50,30 @@ class MD5
 
     virtual const int blockSize() const;
 
-    virtual const int bitsPerUnit() const;
-
     virtual const QString value() const;
 
     virtual const QString name() const
     { return QString("MD5"); }
 
+    virtual Algorithms::Id algorithm() const
+    { return Algorithms::Id::MD5; }
+
     virtual void reset();
 
-    virtual void update(const QByteArray &buffer, const unsigned long long message_length);
+    virtual void finalize();
 
   private:
+    virtual void process_blocks(const unsigned char *blocks, const unsigned long long number);
+
     /** \brief Updates the hash with the char block passed as argument.
      * \param[in] char_block data buffer at maximum 64 bytes in size.
      *
      */
     void process_block(const unsigned char *char_block);
 
-    unsigned long A, B, C, D; /** chaining variables. */
+    friend class MD5MultiBuffer;
+
+    std::uint32_t A, B, C, D; /** chaining variables. */
 };
 
 #endif // HASH_MD5_H_
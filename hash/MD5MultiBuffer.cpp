@@ -0,0 +1,278 @@
+/*
+ File: MD5MultiBuffer.cpp
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Project
+#include <hash/MD5MultiBuffer.h>
+#include <hash/MD5.h>
+#include <CPUFeatures.h>
+
+// C++
+#include <cstdint>
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MD5_MULTIBUFFER_KERNEL
+#endif
+
+#ifdef MD5_MULTIBUFFER_KERNEL
+
+/** Vectors of 4, 8 and 16 lanes of 32 bits, the compiler uses the registers of the target of each kernel. */
+typedef std::uint32_t Lanes4  __attribute__((vector_size(16)));
+typedef std::uint32_t Lanes8  __attribute__((vector_size(32)));
+typedef std::uint32_t Lanes16 __attribute__((vector_size(64)));
+
+/** MD5 table : additive constants, abs(sin(j+1)) 0 =< j =< 63 */
+static const std::uint32_t MD5_CONSTANTS[64] =
+{
+  0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+  0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+  0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+  0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+  0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+  0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+  0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+  0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
+};
+
+/** MD5 table : access order for words */
+static const int MD5_ACCESS_ORDER[64] =
+{
+  0, 1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15,
+  1, 6, 11,  0,  5, 10, 15,  4,  9, 14,  3,  8, 13,  2,  7, 12,
+  5, 8, 11, 14,  1,  4,  7, 10, 13,  0,  3,  6,  9, 12, 15,  2,
+  0, 7, 14,  5, 12,  3, 10,  1,  8, 15,  6, 13,  4, 11,  2,  9
+};
+
+/** MD5 table : bit positions for left shifts */
+static const int MD5_SHIFTS[64] =
+{
+  7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
+  5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20,
+  4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+  6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21
+};
+
+/** \brief Processes one block of each lane.
+ * \param[inout] state chaining variables, one row per variable and one column per lane.
+ * \param[in] blocks data block of each lane.
+ *
+ */
+template<class V, int N>
+__attribute__((always_inline))
+static inline void processBlocks(std::uint32_t state[4][MD5MultiBuffer::MAX_LANES], const unsigned char *const blocks[])
+{
+  // the words of the blocks are little-endian like the processor.
+  V w[16];
+  for(int lane = 0; lane < N; ++lane)
+  {
+    std::uint32_t words[16];
+    std::memcpy(words, blocks[lane], 64);
+
+    for(int i = 0; i < 16; ++i)
+    {
+      w[i][lane] = words[i];
+    }
+  }
+
+  V v[4];
+  for(int i = 0; i < 4; ++i)
+  {
+    std::memcpy(&v[i], state[i], sizeof(V));
+  }
+
+  auto a = v[0], b = v[1], c = v[2], d = v[3];
+
+#pragma GCC unroll 64
+  for(int loop = 0; loop < 64; ++loop)
+  {
+    V f;
+    if(loop < 16)      f = d ^ (b & (c ^ d));
+    else if(loop < 32) f = c ^ (d & (b ^ c));
+    else if(loop < 48) f = b ^ c ^ d;
+    else               f = c ^ (b | ~d);
+
+    const auto temp = a + f + w[MD5_ACCESS_ORDER[loop]] + MD5_CONSTANTS[loop];
+    const auto n    = MD5_SHIFTS[loop];
+
+    a = d;
+    d = c;
+    c = b;
+    b = b + ((temp << n) | (temp >> (32 - n)));
+  }
+
+  v[0] += a;
+  v[1] += b;
+  v[2] += c;
+  v[3] += d;
+
+  for(int i = 0; i < 4; ++i)
+  {
+    std::memcpy(state[i], &v[i], sizeof(V));
+  }
+}
+
+/** \brief Processes one block of four lanes with the SSE2 registers.
+ * \param[inout] state chaining variables.
+ * \param[in] blocks data block of each lane.
+ *
+ */
+static void processBlocks4(std::uint32_t state[4][MD5MultiBuffer::MAX_LANES], const unsigned char *const blocks[])
+{
+  processBlocks<Lanes4, 4>(state, blocks);
+}
+
+/** \brief Processes one block of eight lanes with the AVX2 registers.
+ * \param[inout] state chaining variables.
+ * \param[in] blocks data block of each lane.
+ *
+ */
+__attribute__((target("avx2")))
+static void processBlocks8(std::uint32_t state[4][MD5MultiBuffer::MAX_LANES], const unsigned char *const blocks[])
+{
+  processBlocks<Lanes8, 8>(state, blocks);
+}
+
+/** \brief Processes one block of sixteen lanes with the AVX-512 registers.
+ * \param[inout] state chaining variables.
+ * \param[in] blocks data block of each lane.
+ *
+ */
+__attribute__((target("avx512f")))
+static void processBlocks16(std::uint32_t state[4][MD5MultiBuffer::MAX_LANES], const unsigned char *const blocks[])
+{
+  processBlocks<Lanes16, 16>(state, blocks);
+}
+
+#endif // MD5_MULTIBUFFER_KERNEL
+
+//----------------------------------------------------------------
+int MD5MultiBuffer::lanes()
+{
+#ifdef MD5_MULTIBUFFER_KERNEL
+  static const int number = CPUFeatures::hasAVX512() ? 16 : (CPUFeatures::hasAVX2() ? 8 : 4);
+
+  return number;
+#else
+  return 1;
+#endif
+}
+
+//----------------------------------------------------------------
+bool MD5MultiBuffer::isAvailable()
+{
+  return lanes() > 1;
+}
+
+//----------------------------------------------------------------
+void MD5MultiBuffer::update(MD5 *const hashes[], const unsigned char *const data[], const unsigned long long lengths[], const int number)
+{
+  int next = 0;
+
+#ifdef MD5_MULTIBUFFER_KERNEL
+  // the idle lanes hash this block and their results are discarded.
+  static const unsigned char IDLE_BLOCK[64] = {};
+  alignas(64) std::uint32_t state[4][MAX_LANES];
+  const unsigned char *blocks[MAX_LANES];
+  int message[MAX_LANES];
+  unsigned long long offset[MAX_LANES];
+
+  const auto width = lanes();
+  const auto kernel = (width == 16) ? processBlocks16 : ((width == 8) ? processBlocks8 : processBlocks4);
+
+  // returns the lane message to its hash object with the bytes that haven't been processed.
+  auto release = [&](const int lane)
+  {
+    auto hash = hashes[message[lane]];
+    hash->A = state[0][lane];
+    hash->B = state[1][lane];
+    hash->C = state[2][lane];
+    hash->D = state[3][lane];
+    hash->m_messageLength += offset[lane];
+    hash->update(data[message[lane]] + offset[lane], lengths[message[lane]] - offset[lane]);
+
+    message[lane] = -1;
+  };
+
+  for(int lane = 0; lane < MAX_LANES; ++lane)
+  {
+    message[lane] = -1;
+  }
+
+  while(true)
+  {
+    int active = 0;
+
+    for(int lane = 0; lane < width; ++lane)
+    {
+      // fill the empty lanes with the next messages that have at least one complete block.
+      while(message[lane] == -1 && next < number)
+      {
+        const auto hash = hashes[next];
+        if(hash->m_bufferLength == 0 && lengths[next] >= 64)
+        {
+          message[lane]  = next;
+          offset[lane]   = 0;
+          state[0][lane] = hash->A;
+          state[1][lane] = hash->B;
+          state[2][lane] = hash->C;
+          state[3][lane] = hash->D;
+        }
+        else
+        {
+          hash->update(data[next], lengths[next]);
+        }
+
+        ++next;
+      }
+
+      if(message[lane] != -1) ++active;
+    }
+
+    // a few lanes don't make up for the lost ones, the single message code is faster.
+    if(active < width / 2)
+    {
+      for(int lane = 0; lane < width; ++lane)
+      {
+        if(message[lane] != -1) release(lane);
+      }
+      break;
+    }
+
+    for(int lane = 0; lane < width; ++lane)
+    {
+      blocks[lane] = (message[lane] == -1) ? IDLE_BLOCK : data[message[lane]] + offset[lane];
+    }
+
+    kernel(state, blocks);
+
+    for(int lane = 0; lane < width; ++lane)
+    {
+      if(message[lane] == -1) continue;
+
+      offset[lane] += 64;
+      if(lengths[message[lane]] - offset[lane] < 64) release(lane);
+    }
+  }
+#endif
+
+  for(; next < number; ++next)
+  {
+    hashes[next]->update(data[next], lengths[next]);
+  }
+}
@@ -0,0 +1,57 @@
+/*
+ File: MD5MultiBuffer.h
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HASH_MD5MULTIBUFFER_H_
+#define HASH_MD5MULTIBUFFER_H_
+
+class MD5;
+
+/** \class MD5MultiBuffer
+ * \brief Computes the MD5 of several independent messages at once, each message uses one
+ *        of the 32 bits lanes of the SSE2, AVX2 or AVX-512 registers.
+ *
+ */
+class MD5MultiBuffer
+{
+  public:
+    static const int MAX_LANES = 16; /** maximum number of messages processed at once. */
+
+    /** \brief Returns the number of messages processed at once with the instructions supported
+     * by the processor, 16 with AVX-512, 8 with AVX2 and 4 with SSE2.
+     *
+     */
+    static int lanes();
+
+    /** \brief Returns true if the engine has been compiled and the processor supports it.
+     *
+     */
+    static bool isAvailable();
+
+    /** \brief Updates each hash with its message. The complete blocks are processed in parallel
+     * and the remaining bytes are buffered in the hash object, that must be finalized as usual.
+     * \param[in] hashes hash objects.
+     * \param[in] data messages.
+     * \param[in] lengths lengths of the messages in bytes.
+     * \param[in] number number of messages, can be greater than the number of lanes.
+     *
+     */
+    static void update(MD5 *const hashes[], const unsigned char *const data[], const unsigned long long lengths[], const int number);
+};
+
+#endif // HASH_MD5MULTIBUFFER_H_
@@ -0,0 +1,262 @@
+/*
+ File: MerkleTree.cpp
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Project
+#include <hash/MerkleTree.h>
+
+// Qt
+#include <QThreadPool>
+
+// C++
+#include <algorithm>
+
+const QString MerkleTree::PREFIX = QString("Merkle-");
+
+//----------------------------------------------------------------
+MerkleTree::MerkleTree(const Factory &factory, const unsigned long long chunkSize)
+: m_factory    {factory}
+, m_chunkSize  {std::max(1ULL, chunkSize)}
+, m_chunkLength{0}
+, m_pool       {nullptr}
+, m_pending    {0}
+{
+  const auto hash = m_factory();
+  m_algorithm   = hash->name();
+  m_algorithmId = hash->algorithm();
+  m_blockSize = hash->blockSize();
+}
+
+//----------------------------------------------------------------
+MerkleTree::~MerkleTree()
+{
+  // the threads of the pool still use this object.
+  waitForChunks();
+}
+
+//----------------------------------------------------------------
+const QString MerkleTree::value() const
+{
+  const auto hex = QString::fromLatin1(m_root.toHex());
+
+  QStringList words;
+  for(int i = 0; i < hex.length(); i += 8)
+  {
+    words << hex.mid(i, 8);
+  }
+
+  return words.join(' ');
+}
+
+//----------------------------------------------------------------
+void MerkleTree::reset()
+{
+  Hash::reset();
+
+  waitForChunks();
+
+  m_leaves.clear();
+  m_current = nullptr;
+  m_chunk.clear();
+  m_chunkLength = 0;
+  m_root.clear();
+}
+
+//----------------------------------------------------------------
+void MerkleTree::update(const unsigned char *data, const unsigned long long length)
+{
+  m_messageLength += length;
+
+  auto remaining = length;
+  while(remaining > 0)
+  {
+    const auto bytes = std::min(m_chunkSize - m_chunkLength, remaining);
+
+    if(m_pool && m_chunkLength == 0 && bytes == m_chunkSize)
+    {
+      // complete chunks don't need to be buffered.
+      hashChunk(data, bytes);
+    }
+    else
+    {
+      if(m_pool)
+      {
+        m_chunk.append(reinterpret_cast<const char *>(data), bytes);
+      }
+      else
+      {
+        if(!m_current)
+        {
+          const unsigned char leafPrefix = 0x00;
+          m_current = m_factory();
+          m_current->update(&leafPrefix, 1);
+        }
+
+        m_current->update(data, bytes);
+      }
+
+      m_chunkLength += bytes;
+
+      if(m_chunkLength == m_chunkSize)
+      {
+        if(m_pool)
+        {
+          hashChunk(reinterpret_cast<const unsigned char *>(m_chunk.constData()), m_chunk.size());
+          m_chunk.clear();
+        }
+        else
+        {
+          m_current->finalize();
+          m_leaves.push_back(digest(m_current));
+          m_current = nullptr;
+        }
+
+        m_chunkLength = 0;
+      }
+    }
+
+    data += bytes;
+    remaining -= bytes;
+  }
+}
+
+//----------------------------------------------------------------
+void MerkleTree::finalize()
+{
+  // the last chunk can be shorter than the rest.
+  if(m_chunkLength > 0)
+  {
+    if(m_pool)
+    {
+      m_leaves.push_back(leafDigest(reinterpret_cast<const unsigned char *>(m_chunk.constData()), m_chunk.size()));
+      m_chunk.clear();
+    }
+    else
+    {
+      m_current->finalize();
+      m_leaves.push_back(digest(m_current));
+      m_current = nullptr;
+    }
+
+    m_chunkLength = 0;
+  }
+
+  waitForChunks();
+
+  if(m_leaves.empty())
+  {
+    // the tree of an empty message is the hash of the empty string.
+    auto hash = m_factory();
+    hash->finalize();
+    m_root = digest(hash);
+  }
+  else
+  {
+    m_root = treeDigest(0, m_leaves.size());
+  }
+}
+
+//----------------------------------------------------------------
+QStringList MerkleTree::chunkValues() const
+{
+  QStringList values;
+  for(const auto &leaf: m_leaves)
+  {
+    values << QString::fromLatin1(leaf.toHex());
+  }
+
+  return values;
+}
+
+//----------------------------------------------------------------
+void MerkleTree::hashChunk(const unsigned char *data, const unsigned long long length)
+{
+  // the references to the elements of a deque aren't invalidated by push_back().
+  m_leaves.emplace_back();
+  auto &leaf = m_leaves.back();
+
+  // the data is copied only if a thread is free to hash it, the caller reuses its buffer.
+  if(m_pool->activeThreadCount() < m_pool->maxThreadCount())
+  {
+    const QByteArray chunk(reinterpret_cast<const char *>(data), length);
+    auto hashLeaf = [this, chunk, &leaf]()
+    {
+      leaf = leafDigest(reinterpret_cast<const unsigned char *>(chunk.constData()), chunk.size());
+      m_finished.release();
+    };
+
+    if(m_pool->tryStart(hashLeaf))
+    {
+      ++m_pending;
+      return;
+    }
+  }
+
+  leaf = leafDigest(data, length);
+}
+
+//----------------------------------------------------------------
+QByteArray MerkleTree::leafDigest(const unsigned char *data, const unsigned long long length) const
+{
+  const unsigned char leafPrefix = 0x00;
+
+  auto hash = m_factory();
+  hash->update(&leafPrefix, 1);
+  hash->update(data, length);
+  hash->finalize();
+
+  return digest(hash);
+}
+
+//----------------------------------------------------------------
+QByteArray MerkleTree::treeDigest(const std::size_t first, const std::size_t number) const
+{
+  if(number == 1) return m_leaves.at(first);
+
+  // the left subtree is the largest complete tree with less leaves than the node.
+  std::size_t split = 1;
+  while(2 * split < number) split <<= 1;
+
+  const auto left  = treeDigest(first, split);
+  const auto right = treeDigest(first + split, number - split);
+
+  const unsigned char nodePrefix = 0x01;
+
+  auto hash = m_factory();
+  hash->update(&nodePrefix, 1);
+  hash->update(reinterpret_cast<const unsigned char *>(left.constData()), left.size());
+  hash->update(reinterpret_cast<const unsigned char *>(right.constData()), right.size());
+  hash->finalize();
+
+  return digest(hash);
+}
+
+//----------------------------------------------------------------
+void MerkleTree::waitForChunks()
+{
+  m_finished.acquire(m_pending);
+  m_pending = 0;
+}
+
+//----------------------------------------------------------------
+QByteArray MerkleTree::digest(const HashSPtr &hash)
+{
+  auto value = hash->value();
+
+  return QByteArray::fromHex(value.remove(' ').remove('\n').toLatin1());
+}
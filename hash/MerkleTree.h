@@ -0,0 +1,175 @@
+/*
+ File: MerkleTree.h
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HASH_MERKLETREE_H_
+#define HASH_MERKLETREE_H_
+
+// Project
+#include <Hash.h>
+
+// Qt
+#include <QSemaphore>
+#include <QStringList>
+
+// C++
+#include <deque>
+#include <functional>
+
+class QThreadPool;
+
+/** \class MerkleTree
+ * \brief Hashes the message in chunks of fixed size with any other hash and combines the digests
+ *        of the chunks in a binary tree like RFC 6962, the leaves are H(0x00||chunk) and the
+ *        nodes H(0x01||left||right). The chunks are independent and can be hashed by the threads
+ *        of a pool, and their digests tell which chunks of a file are corrupt.
+ *
+ */
+class MerkleTree
+: public Hash
+{
+  public:
+    using Factory = std::function<HashSPtr()>;
+
+    /** \brief MerkleTree class constructor.
+     * \param[in] factory returns a new object of the hash of the chunks and the nodes.
+     * \param[in] chunkSize size of the chunks in bytes.
+     *
+     */
+    explicit MerkleTree(const Factory &factory, const unsigned long long chunkSize = DEFAULT_CHUNK_SIZE);
+
+    /** \brief MerkleTree class virtual destructor.
+     *
+     */
+    virtual ~MerkleTree();
+
+    virtual const int blockSize() const override
+    { return m_blockSize; }
+
+    virtual const QString value() const override;
+
+    virtual const QString name() const override
+    { return treeName(m_algorithm); }
+
+    virtual Algorithms::Id algorithm() const override
+    { return m_algorithmId; }
+
+    virtual void reset() override;
+
+    virtual void update(const unsigned char *data, const unsigned long long length) override;
+
+    virtual void finalize() override;
+
+    /** \brief Sets the pool of threads used to hash the chunks. The pool must exist while
+     * the hash is being updated.
+     * \param[in] pool thread pool or nullptr to hash the chunks in the calling thread.
+     *
+     */
+    void setThreadPool(QThreadPool *pool)
+    { m_pool = pool; }
+
+    /** \brief Returns the size of the chunks in bytes.
+     *
+     */
+    unsigned long long chunkSize() const
+    { return m_chunkSize; }
+
+    /** \brief Returns the digests of the leaves in hexadecimal, valid after the finalization.
+     *
+     */
+    QStringList chunkValues() const;
+
+    /** \brief Returns the name of the Merkle tree of the given hash.
+     * \param[in] algorithm name of the hash of the chunks.
+     *
+     */
+    static QString treeName(const QString &algorithm)
+    { return PREFIX + algorithm; }
+
+    /** \brief Returns true if the given name is the name of a Merkle tree.
+     * \param[in] name hash name.
+     *
+     */
+    static bool isTreeName(const QString &name)
+    { return name.startsWith(PREFIX); }
+
+    /** \brief Returns the name of the hash of the chunks of the given Merkle tree name.
+     * \param[in] name Merkle tree name.
+     *
+     */
+    static QString algorithmName(const QString &name)
+    { return name.mid(PREFIX.length()); }
+
+    static const unsigned long long DEFAULT_CHUNK_SIZE = 4*1024*1024; /** default chunk size, 4 MiB. */
+    static const QString PREFIX;                                       /** prefix of the tree names.  */
+
+  private:
+    /** \brief The data is added to the chunks in update().
+     *
+     */
+    virtual void process_blocks(const unsigned char *blocks, const unsigned long long number) override
+    {};
+
+    /** \brief Hashes a complete chunk in the calling thread or in a thread of the pool.
+     * \param[in] data chunk data.
+     * \param[in] length length of the chunk in bytes.
+     *
+     */
+    void hashChunk(const unsigned char *data, const unsigned long long length);
+
+    /** \brief Returns the digest of a leaf.
+     * \param[in] data chunk data.
+     * \param[in] length length of the chunk in bytes.
+     *
+     */
+    QByteArray leafDigest(const unsigned char *data, const unsigned long long length) const;
+
+    /** \brief Returns the digest of the subtree of the given leaves.
+     * \param[in] first index of the first leaf.
+     * \param[in] number number of leaves, at least one.
+     *
+     */
+    QByteArray treeDigest(const std::size_t first, const std::size_t number) const;
+
+    /** \brief Waits until the chunks given to the threads of the pool have been hashed.
+     *
+     */
+    void waitForChunks();
+
+    /** \brief Returns the digest of the given finalized hash.
+     * \param[in] hash hash object.
+     *
+     */
+    static QByteArray digest(const HashSPtr &hash);
+
+    Factory                  m_factory;     /** creates the hashes of the leaves and nodes.         */
+    QString                  m_algorithm;   /** name of the hash of the leaves and nodes.           */
+    Algorithms::Id           m_algorithmId; /** identifier of the hash of the leaves and nodes.     */
+    int                      m_blockSize;   /** block size of the hash of the leaves and nodes.     */
+    unsigned long long       m_chunkSize;   /** size of the chunks in bytes.                        */
+    std::deque<QByteArray>   m_leaves;      /** digests of the chunks, in order.                    */
+    HashSPtr                 m_current;     /** hash of the current chunk if there is no pool.      */
+    QByteArray               m_chunk;       /** data of the current chunk if there is a pool.       */
+    unsigned long long       m_chunkLength; /** length of the data in the current chunk.            */
+    QByteArray               m_root;        /** digest of the root node.                            */
+    QThreadPool             *m_pool;        /** pool for the chunks or nullptr if none.             */
+    QSemaphore               m_finished;    /** released by the threads when they hash a chunk.     */
+    int                      m_pending;     /** number of chunks given to the threads of the pool.  */
+};
+
+#endif // HASH_MERKLETREE_H_
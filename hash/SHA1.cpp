@@ -19,6 +19,7 @@
 
 // Project
 #include <hash/SHA1.h>
+#include <hash/SHAExtensions.h>
 
 // C++
 #include <cstring>
@@ -39,60 +40,67 @@ const int SHA1::blockSize() const
 }
 
 //----------------------------------------------------------------
-const int SHA1::bitsPerUnit() const
+void SHA1::process_blocks(const unsigned char *blocks, const unsigned long long number)
 {
-  return 8;
-}
+  static const bool useExtensions = SHAExtensions::isAvailable();
 
-//----------------------------------------------------------------
-void SHA1::update(const QByteArray& buffer, const unsigned long long message_length)
-{
-  auto length = buffer.length();
-
-  if (64 == length)
+  if(useExtensions)
   {
-    process_block(reinterpret_cast<const unsigned char *>(buffer.constData()));
+    SHAExtensions::sha1(m_state, blocks, number);
     return;
   }
 
-  QByteArray finalBuffer{64,0};
-  std::memcpy(finalBuffer.data(), buffer.constData(), length);
-  finalBuffer[length++] = 0x80;
+  for(unsigned long long i = 0; i < number; ++i)
+  {
+    SHA1::process_block(blocks + (i * 64));
+  }
+}
+
+//----------------------------------------------------------------
+void SHA1::finalize()
+{
+  auto length = m_bufferLength;
+  m_buffer[length++] = 0x80;
 
-  // if length < 55 there is space for message length, we process 1 block
+  // if length <= 56 there is space for message length, we process 1 block
   // if not, we need to process two blocks
-  if (length >= 56)
+  if (length > 56)
   {
-    process_block(reinterpret_cast<const unsigned char *>(finalBuffer.constData()));
-    std::memset(finalBuffer.data(), 0x00, 64);
+    std::memset(m_buffer + length, 0x00, 64 - length);
+    process_block(m_buffer);
+    length = 0;
   }
 
+  std::memset(m_buffer + length, 0x00, 56 - length);
+
+  const auto bits = m_messageLength * 8;
   for (int loop = 0; loop < 8; loop++)
   {
-    finalBuffer[56+loop] = static_cast<unsigned char>(((message_length) >> (56 - (8 * loop))) & 0xFF);
+    m_buffer[56+loop] = static_cast<unsigned char>((bits >> (56 - (8 * loop))) & 0xFF);
   }
 
-  process_block(reinterpret_cast<const unsigned char *>(finalBuffer.constData()));
+  process_block(m_buffer);
+  m_bufferLength = 0;
 }
 
 //----------------------------------------------------------------
 const QString SHA1::value() const
 {
-  return QString("%1 %2 %3 %4 %5").arg(SHA1_A, 8, 16, QChar('0'))
-                                  .arg(SHA1_B, 8, 16, QChar('0'))
-                                  .arg(SHA1_C, 8, 16, QChar('0'))
-                                  .arg(SHA1_D, 8, 16, QChar('0'))
-                                  .arg(SHA1_E, 8, 16, QChar('0'));
+  return QString("%1 %2 %3 %4 %5").arg(m_state[0], 8, 16, QChar('0'))
+                                  .arg(m_state[1], 8, 16, QChar('0'))
+                                  .arg(m_state[2], 8, 16, QChar('0'))
+                                  .arg(m_state[3], 8, 16, QChar('0'))
+                                  .arg(m_state[4], 8, 16, QChar('0'));
 }
 
 //----------------------------------------------------------------
 void SHA1::process_block(const unsigned char *char_block)
 {
-  unsigned long a, b, c, d, e, temp;
-  unsigned long expanded_blk[80];
+  std::uint32_t a, b, c, d, e, temp;
+  std::uint32_t expanded_blk[16];
   unsigned int loop;
 
-  auto Function = [](unsigned int loop, unsigned long x, unsigned long y, unsigned long z)
+  auto Function = [](unsigned int loop, std::uint32_t x, std::uint32_t y, std::uint32_t z) -> std::uint32_t
   {
     if (loop < 20)
     {
@@ -117,40 +125,39 @@ void SHA1::process_block(const unsigned char *char_block)
   };
 
   // Rotational shift to the left
-  auto ROTL = [](unsigned long x,  int n )
+  auto ROTL = [](std::uint32_t x,  int n )
   {
-    return ((x << n) | (( x & 0xFFFFFFFF ) >> ( 32 - n )));
+    return static_cast<std::uint32_t>((x << n) | (x >> (32 - n)));
   };
 
-  // convert the block from unsigned char to unsigned long
+  // convert the block from unsigned char to 32 bits words
   for (loop = 0; loop < 16; loop++)
   {
-    expanded_blk[loop] = ((unsigned long) (char_block[(loop*4)]   << 24)) |
-                         ((unsigned long) (char_block[(loop*4)+1] << 16)) |
-                         ((unsigned long) (char_block[(loop*4)+2] <<  8)) |
-                         ((unsigned long) (char_block[(loop*4)+3]));
-  }
-
-  // expanding the block from 16 to 80
-  for (loop = 16; loop < 80; loop++)
-  {
-    expanded_blk[loop] = ROTL((((expanded_blk[loop-3]   ^
-                                 expanded_blk[loop-8])  ^
-                                 expanded_blk[loop-14]) ^
-                                 expanded_blk[loop-16]), 1);
+    expanded_blk[loop] = (static_cast<std::uint32_t>(char_block[(loop*4)])   << 24) |
+                         (static_cast<std::uint32_t>(char_block[(loop*4)+1]) << 16) |
+                         (static_cast<std::uint32_t>(char_block[(loop*4)+2]) <<  8) |
+                         (static_cast<std::uint32_t>(char_block[(loop*4)+3]));
   }
 
   // initialize working variables for this block
-  a = SHA1_A;
-  b = SHA1_B;
-  c = SHA1_C;
-  d = SHA1_D;
-  e = SHA1_E;
+  a = m_state[0];
+  b = m_state[1];
+  c = m_state[2];
+  d = m_state[3];
+  e = m_state[4];
 
-  // processing
+  // processing, the block is expanded in place as only the last 16 words are needed.
   for (loop = 0; loop < 80; loop++)
   {
-      temp = ROTL(a,5) + Function(loop,b,c,d) + e + expanded_blk[loop];
+      if (loop >= 16)
+      {
+        expanded_blk[loop & 15] = ROTL(expanded_blk[(loop-3)  & 15] ^
+                                       expanded_blk[(loop-8)  & 15] ^
+                                       expanded_blk[(loop-14) & 15] ^
+                                       expanded_blk[loop & 15], 1);
+      }
+
+      temp = ROTL(a,5) + Function(loop,b,c,d) + e + expanded_blk[loop & 15];
       e = d;
       d = c;
       c = ROTL(b,30);
@@ -159,19 +166,21 @@ void SHA1::process_block(const unsigned char *char_block)
   }
 
   // set the hash value for next block
-  SHA1_A += a;
-  SHA1_B += b;
-  SHA1_C += c;
-  SHA1_D += d;
-  SHA1_E += e;
+  m_state[0] += a;
+  m_state[1] += b;
+  m_state[2] += c;
+  m_state[3] += d;
+  m_state[4] += e;
 }
 
 //----------------------------------------------------------------
 void SHA1::reset()
 {
-  SHA1_A = 0x67452301;
-  SHA1_B = 0xEFCDAB89;
-  SHA1_C = 0x98BADCFE;
-  SHA1_D = 0x10325476;
-  SHA1_E = 0xC3D2E1F0;
+  Hash::reset();
+
+  m_state[0] = 0x67452301;
+  m_state[1] = 0xEFCDAB89;
+  m_state[2] = 0x98BADCFE;
+  m_state[3] = 0x10325476;
+  m_state[4] = 0xC3D2E1F0;
 }
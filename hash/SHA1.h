@@ -23,6 +23,9 @@
 // Project
 #include <Hash.h>
 
+// C++
+#include <cstdint>
+
 /** \class SHA
  * \brief Implements the Secure Hash Algorithm 1
  *
@@ -44,29 +47,30 @@ class SHA1
 
     virtual const int blockSize() const;
 
-    virtual const int bitsPerUnit() const;
-
     virtual const QString value() const;
 
     virtual const QString name() const
     { return QString("SHA-1"); }
 
+    virtual Algorithms::Id algorithm() const
+    { return Algorithms::Id::SHA1; }
+
     virtual void reset();
 
-    virtual void update(const QByteArray &buffer, const unsigned long long message_length);
+    virtual void finalize();
   private:
+    friend class SHA1MultiBuffer;
+    friend class SHAExtensionsTest;
+
+    virtual void process_blocks(const unsigned char *blocks, const unsigned long long number);
+
     /** \brief Updates the hash with the char block passed as argument.
      * \param[in] char_block data buffer at maximum 64 bytes in size.
      *
      */
     virtual void process_block(const unsigned char *char_block);
 
-    /** chaining variables. */
-    unsigned long SHA1_A;
-    unsigned long SHA1_B;
-    unsigned long SHA1_C;
-    unsigned long SHA1_D;
-    unsigned long SHA1_E;
+    std::uint32_t m_state[5]; /** chaining variables. */
 };
 
 #endif // HASH_SHA1_H_
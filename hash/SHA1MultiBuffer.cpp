@@ -0,0 +1,259 @@
+/*
+ File: SHA1MultiBuffer.cpp
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Project
+#include <hash/SHA1MultiBuffer.h>
+#include <hash/SHA1.h>
+#include <hash/SHAExtensions.h>
+#include <CPUFeatures.h>
+
+// C++
+#include <cstdint>
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SHA1_MULTIBUFFER_KERNEL
+#endif
+
+#ifdef SHA1_MULTIBUFFER_KERNEL
+
+/** Vectors of 4, 8 and 16 lanes of 32 bits, the compiler uses the registers of the target of each kernel. */
+typedef std::uint32_t Lanes4  __attribute__((vector_size(16)));
+typedef std::uint32_t Lanes8  __attribute__((vector_size(32)));
+typedef std::uint32_t Lanes16 __attribute__((vector_size(64)));
+
+/** \brief Processes one block of each lane.
+ * \param[inout] state chaining variables, one row per variable and one column per lane.
+ * \param[in] blocks data block of each lane.
+ *
+ */
+template<class V, int N>
+__attribute__((always_inline))
+static inline void processBlocks(std::uint32_t state[5][SHA1MultiBuffer::MAX_LANES], const unsigned char *const blocks[])
+{
+  // SHA-1 is big-endian, the words are reversed while loading them.
+  V w[16];
+  for(int lane = 0; lane < N; ++lane)
+  {
+    std::uint32_t words[16];
+    std::memcpy(words, blocks[lane], 64);
+
+    for(int i = 0; i < 16; ++i)
+    {
+      w[i][lane] = __builtin_bswap32(words[i]);
+    }
+  }
+
+  V v[5];
+  for(int i = 0; i < 5; ++i)
+  {
+    std::memcpy(&v[i], state[i], sizeof(V));
+  }
+
+  auto a = v[0], b = v[1], c = v[2], d = v[3], e = v[4];
+
+#pragma GCC unroll 80
+  for(int loop = 0; loop < 80; ++loop)
+  {
+    auto &word = w[loop & 15];
+
+    // expanding the block in place as only the last 16 words are needed.
+    if(loop >= 16)
+    {
+      const auto x = w[(loop - 3) & 15] ^ w[(loop - 8) & 15] ^ w[(loop - 14) & 15] ^ word;
+      word = (x << 1) | (x >> 31);
+    }
+
+    V f;
+    if(loop < 20)      f = (d ^ (b & (c ^ d))) + 0x5A827999;
+    else if(loop < 40) f = (b ^ c ^ d) + 0x6ED9EBA1;
+    else if(loop < 60) f = ((b & c) | (d & (b | c))) + 0x8F1BBCDC;
+    else               f = (b ^ c ^ d) + 0xCA62C1D6;
+
+    const auto temp = ((a << 5) | (a >> 27)) + f + e + word;
+
+    e = d;
+    d = c;
+    c = (b << 30) | (b >> 2);
+    b = a;
+    a = temp;
+  }
+
+  v[0] += a;
+  v[1] += b;
+  v[2] += c;
+  v[3] += d;
+  v[4] += e;
+
+  for(int i = 0; i < 5; ++i)
+  {
+    std::memcpy(state[i], &v[i], sizeof(V));
+  }
+}
+
+/** \brief Processes one block of four lanes with the SSE2 registers.
+ * \param[inout] state chaining variables.
+ * \param[in] blocks data block of each lane.
+ *
+ */
+static void processBlocks4(std::uint32_t state[5][SHA1MultiBuffer::MAX_LANES], const unsigned char *const blocks[])
+{
+  processBlocks<Lanes4, 4>(state, blocks);
+}
+
+/** \brief Processes one block of eight lanes with the AVX2 registers.
+ * \param[inout] state chaining variables.
+ * \param[in] blocks data block of each lane.
+ *
+ */
+__attribute__((target("avx2")))
+static void processBlocks8(std::uint32_t state[5][SHA1MultiBuffer::MAX_LANES], const unsigned char *const blocks[])
+{
+  processBlocks<Lanes8, 8>(state, blocks);
+}
+
+/** \brief Processes one block of sixteen lanes with the AVX-512 registers.
+ * \param[inout] state chaining variables.
+ * \param[in] blocks data block of each lane.
+ *
+ */
+__attribute__((target("avx512f")))
+static void processBlocks16(std::uint32_t state[5][SHA1MultiBuffer::MAX_LANES], const unsigned char *const blocks[])
+{
+  processBlocks<Lanes16, 16>(state, blocks);
+}
+
+#endif // SHA1_MULTIBUFFER_KERNEL
+
+//----------------------------------------------------------------
+int SHA1MultiBuffer::lanes()
+{
+#ifdef SHA1_MULTIBUFFER_KERNEL
+  static const int number = CPUFeatures::hasAVX512() ? 16 : (CPUFeatures::hasAVX2() ? 8 : 4);
+
+  return number;
+#else
+  return 1;
+#endif
+}
+
+//----------------------------------------------------------------
+bool SHA1MultiBuffer::isAvailable()
+{
+  // sixteen lanes are faster than a single message with the SHA extensions, fewer aren't.
+  return lanes() == 16 || (lanes() > 1 && !SHAExtensions::isAvailable());
+}
+
+//----------------------------------------------------------------
+void SHA1MultiBuffer::update(SHA1 *const hashes[], const unsigned char *const data[], const unsigned long long lengths[], const int number)
+{
+  int next = 0;
+
+#ifdef SHA1_MULTIBUFFER_KERNEL
+  // the idle lanes hash this block and their results are discarded.
+  static const unsigned char IDLE_BLOCK[64] = {};
+  alignas(64) std::uint32_t state[5][MAX_LANES];
+  const unsigned char *blocks[MAX_LANES];
+  int message[MAX_LANES];
+  unsigned long long offset[MAX_LANES];
+
+  const auto width = lanes();
+  const auto kernel = (width == 16) ? processBlocks16 : ((width == 8) ? processBlocks8 : processBlocks4);
+
+  // returns the lane message to its hash object with the bytes that haven't been processed.
+  auto release = [&](const int lane)
+  {
+    auto hash = hashes[message[lane]];
+    for(int i = 0; i < 5; ++i)
+    {
+      hash->m_state[i] = state[i][lane];
+    }
+    hash->m_messageLength += offset[lane];
+    hash->update(data[message[lane]] + offset[lane], lengths[message[lane]] - offset[lane]);
+
+    message[lane] = -1;
+  };
+
+  for(int lane = 0; lane < MAX_LANES; ++lane)
+  {
+    message[lane] = -1;
+  }
+
+  while(true)
+  {
+    int active = 0;
+
+    for(int lane = 0; lane < width; ++lane)
+    {
+      // fill the empty lanes with the next messages that have at least one complete block.
+      while(message[lane] == -1 && next < number)
+      {
+        const auto hash = hashes[next];
+        if(hash->m_bufferLength == 0 && lengths[next] >= 64)
+        {
+          message[lane] = next;
+          offset[lane]  = 0;
+          for(int i = 0; i < 5; ++i)
+          {
+            state[i][lane] = hash->m_state[i];
+          }
+        }
+        else
+        {
+          hash->update(data[next], lengths[next]);
+        }
+
+        ++next;
+      }
+
+      if(message[lane] != -1) ++active;
+    }
+
+    // a few lanes don't make up for the lost ones, the single message code is faster.
+    if(active < width / 2)
+    {
+      for(int lane = 0; lane < width; ++lane)
+      {
+        if(message[lane] != -1) release(lane);
+      }
+      break;
+    }
+
+    for(int lane = 0; lane < width; ++lane)
+    {
+      blocks[lane] = (message[lane] == -1) ? IDLE_BLOCK : data[message[lane]] + offset[lane];
+    }
+
+    kernel(state, blocks);
+
+    for(int lane = 0; lane < width; ++lane)
+    {
+      if(message[lane] == -1) continue;
+
+      offset[lane] += 64;
+      if(lengths[message[lane]] - offset[lane] < 64) release(lane);
+    }
+  }
+#endif
+
+  for(; next < number; ++next)
+  {
+    hashes[next]->update(data[next], lengths[next]);
+  }
+}
@@ -19,9 +19,10 @@
 
 // Project
 #include <hash/SHA224.h>
+#include <hash/SHAExtensions.h>
 
 /** SHA-224 Constants */
-static const unsigned long SHA224_CONSTANTS[64] =
+static const std::uint32_t SHA224_CONSTANTS[64] =
 {
   0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
   0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
@@ -44,43 +45,60 @@ SHA224::SHA224()
 //----------------------------------------------------------------
 const QString SHA224::value() const
 {
-  return QString("%1 %2 %3 %4 %5 %6 %7").arg(SHA224_A, 8, 16, QChar('0'))
-                                        .arg(SHA224_B, 8, 16, QChar('0'))
-                                        .arg(SHA224_C, 8, 16, QChar('0'))
-                                        .arg(SHA224_D, 8, 16, QChar('0'))
-                                        .arg(SHA224_E, 8, 16, QChar('0'))
-                                        .arg(SHA224_F, 8, 16, QChar('0'))
-                                        .arg(SHA224_G, 8, 16, QChar('0'));
+  return QString("%1 %2 %3 %4 %5 %6 %7").arg(m_state[0], 8, 16, QChar('0'))
+                                        .arg(m_state[1], 8, 16, QChar('0'))
+                                        .arg(m_state[2], 8, 16, QChar('0'))
+                                        .arg(m_state[3], 8, 16, QChar('0'))
+                                        .arg(m_state[4], 8, 16, QChar('0'))
+                                        .arg(m_state[5], 8, 16, QChar('0'))
+                                        .arg(m_state[6], 8, 16, QChar('0'));
+}
+
+//----------------------------------------------------------------
+void SHA224::process_blocks(const unsigned char *blocks, const unsigned long long number)
+{
+  static const bool useExtensions = SHAExtensions::isAvailable();
+
+  if(useExtensions)
+  {
+    SHAExtensions::sha256(m_state, blocks, number);
+    return;
+  }
+
+  for(unsigned long long i = 0; i < number; ++i)
+  {
+    SHA224::process_block(blocks + (i * 64));
+  }
 }
 
 //----------------------------------------------------------------
 void SHA224::process_block(const unsigned char *char_block)
 {
-  unsigned long a, b, c, d, e, f, g, h, temp1, temp2;
-  unsigned long expanded_blk[64];
+  std::uint32_t a, b, c, d, e, f, g, h, temp1, temp2;
+  std::uint32_t expanded_blk[64];
   unsigned int loop;
 
   // Rotational shift to the right
-  auto ROTR = [](unsigned long x, unsigned int n) { return (((x & 0xFFFFFFFF) >> n) | (x << (32 - n))); };
+  auto ROTR = [](std::uint32_t x, unsigned int n) { return static_cast<std::uint32_t>((x >> n) | (x << (32 - n))); };
 
   // Shift to the right
-  auto SHR = [](unsigned long x, unsigned int n) { return ((x & 0xFFFFFFFF) >> n); };
+  auto SHR = [](std::uint32_t x, unsigned int n) { return (x >> n); };
 
   // SHA-224 uses six functions. As they do not depend on loop index we could inline them.
-   auto SHA224_F1 = [](unsigned long x, unsigned long y, unsigned long z) { return ((x & y) | (z & (x | y))); };
-  auto SHA224_F2 = [](unsigned long x, unsigned long y, unsigned long z) { return (z ^ (x & (y ^ z))); };
-  auto SHA224_F3 = [ROTR](unsigned long x) { return (ROTR(x, 2) ^ ROTR(x,13) ^ ROTR(x,22)); };
-  auto SHA224_F4 = [ROTR](unsigned long x) { return (ROTR(x, 6) ^ ROTR(x,11) ^ ROTR(x,25)); };
-  auto SHA224_F5 = [ROTR, SHR](unsigned long x) { return (ROTR(x, 7) ^ ROTR(x,18) ^  SHR(x, 3)); };
-  auto SHA224_F6 = [ROTR, SHR](unsigned long x) { return (ROTR(x,17) ^ ROTR(x,19) ^  SHR(x,10)); };
-
-  // convert the block from unsigned char to unsigned long
+  auto SHA224_F1 = [](std::uint32_t x, std::uint32_t y, std::uint32_t z) { return ((x & y) | (z & (x | y))); };
+  auto SHA224_F2 = [](std::uint32_t x, std::uint32_t y, std::uint32_t z) { return (z ^ (x & (y ^ z))); };
+  auto SHA224_F3 = [ROTR](std::uint32_t x) { return (ROTR(x, 2) ^ ROTR(x,13) ^ ROTR(x,22)); };
+  auto SHA224_F4 = [ROTR](std::uint32_t x) { return (ROTR(x, 6) ^ ROTR(x,11) ^ ROTR(x,25)); };
+  auto SHA224_F5 = [ROTR, SHR](std::uint32_t x) { return (ROTR(x, 7) ^ ROTR(x,18) ^  SHR(x, 3)); };
+  auto SHA224_F6 = [ROTR, SHR](std::uint32_t x) { return (ROTR(x,17) ^ ROTR(x,19) ^  SHR(x,10)); };
+
+  // convert the block from unsigned char to 32 bits words
   for (loop = 0; loop < 16; loop++)
   {
-    expanded_blk[loop] = ((unsigned long) (char_block[(loop*4)]   << 24)) |
-                         ((unsigned long) (char_block[(loop*4)+1] << 16)) |
-                         ((unsigned long) (char_block[(loop*4)+2] <<  8)) |
-                         ((unsigned long) (char_block[(loop*4)+3]));
+    expanded_blk[loop] = (static_cast<std::uint32_t>(char_block[(loop*4)])   << 24) |
+                         (static_cast<std::uint32_t>(char_block[(loop*4)+1]) << 16) |
+                         (static_cast<std::uint32_t>(char_block[(loop*4)+2]) <<  8) |
+                         (static_cast<std::uint32_t>(char_block[(loop*4)+3]));
   }
 
   // expanding the block from 16 to 80
@@ -93,14 +111,14 @@ void SHA224::process_block(const unsigned char *char_block)
   }
 
   // initialize working variables for this block
-  a = SHA224_A;
-  b = SHA224_B;
-  c = SHA224_C;
-  d = SHA224_D;
-  e = SHA224_E;
-  f = SHA224_F;
-  g = SHA224_G;
-  h = SHA224_H;
+  a = m_state[0];
+  b = m_state[1];
+  c = m_state[2];
+  d = m_state[3];
+  e = m_state[4];
+  f = m_state[5];
+  g = m_state[6];
+  h = m_state[7];
 
   // process block
   for (loop = 0; loop < 64; loop++)
@@ -119,25 +137,27 @@ void SHA224::process_block(const unsigned char *char_block)
   }
 
   // set the hash value for next block
-  SHA224_A += a;
-  SHA224_B += b;
-  SHA224_C += c;
-  SHA224_D += d;
-  SHA224_E += e;
-  SHA224_F += f;
-  SHA224_G += g;
-  SHA224_H += h;
+  m_state[0] += a;
+  m_state[1] += b;
+  m_state[2] += c;
+  m_state[3] += d;
+  m_state[4] += e;
+  m_state[5] += f;
+  m_state[6] += g;
+  m_state[7] += h;
 }
 
 //----------------------------------------------------------------
 void SHA224::reset()
 {
-  SHA224_A = 0xc1059ed8;
-  SHA224_B = 0x367cd507;
-  SHA224_C = 0x3070dd17;
-  SHA224_D = 0xf70e5939;
-  SHA224_E = 0xffc00b31;
-  SHA224_F = 0x68581511;
-  SHA224_G = 0x64f98fa7;
-  SHA224_H = 0xbefa4fa4;
+  Hash::reset();
+
+  m_state[0] = 0xc1059ed8;
+  m_state[1] = 0x367cd507;
+  m_state[2] = 0x3070dd17;
+  m_state[3] = 0xf70e5939;
+  m_state[4] = 0xffc00b31;
+  m_state[5] = 0x68581511;
+  m_state[6] = 0x64f98fa7;
+  m_state[7] = 0xbefa4fa4;
 }
@@ -47,20 +47,19 @@ class SHA224
     virtual const QString name() const override
     { return QString("SHA-224"); }
 
+    virtual Algorithms::Id algorithm() const override
+    { return Algorithms::Id::SHA224; }
+
     virtual void reset() override;
 
   private:
+    friend class SHAExtensionsTest;
+
+    virtual void process_blocks(const unsigned char *blocks, const unsigned long long number) override;
+
     virtual void process_block(const unsigned char *char_block) override;
 
-    /** chaining variables */
-    unsigned long SHA224_A;
-    unsigned long SHA224_B;
-    unsigned long SHA224_C;
-    unsigned long SHA224_D;
-    unsigned long SHA224_E;
-    unsigned long SHA224_F;
-    unsigned long SHA224_G;
-    unsigned long SHA224_H;
+    std::uint32_t m_state[8]; /** chaining variables. */
 };
 
 #endif // HASH_SHA224_H_
@@ -17,10 +17,12 @@
  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+// Project
 #include <hash/SHA256.h>
+#include <hash/SHAExtensions.h>
 
 /** SHA-256 Constants */
-static const unsigned long SHA256_CONSTANTS[64] =
+static const std::uint32_t SHA256_CONSTANTS[64] =
 {
   0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
   0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
@@ -43,44 +45,61 @@ SHA256::SHA256()
 //----------------------------------------------------------------
 const QString SHA256::value() const
 {
-  return QString("%1 %2 %3 %4 %5 %6 %7 %8").arg(SHA256_A, 8, 16, QChar('0'))
-                                           .arg(SHA256_B, 8, 16, QChar('0'))
-                                           .arg(SHA256_C, 8, 16, QChar('0'))
-                                           .arg(SHA256_D, 8, 16, QChar('0'))
-                                           .arg(SHA256_E, 8, 16, QChar('0'))
-                                           .arg(SHA256_F, 8, 16, QChar('0'))
-                                           .arg(SHA256_G, 8, 16, QChar('0'))
-                                           .arg(SHA256_H, 8, 16, QChar('0'));
+  return QString("%1 %2 %3 %4 %5 %6 %7 %8").arg(m_state[0], 8, 16, QChar('0'))
+                                           .arg(m_state[1], 8, 16, QChar('0'))
+                                           .arg(m_state[2], 8, 16, QChar('0'))
+                                           .arg(m_state[3], 8, 16, QChar('0'))
+                                           .arg(m_state[4], 8, 16, QChar('0'))
+                                           .arg(m_state[5], 8, 16, QChar('0'))
+                                           .arg(m_state[6], 8, 16, QChar('0'))
+                                           .arg(m_state[7], 8, 16, QChar('0'));
+}
+
+//----------------------------------------------------------------
+void SHA256::process_blocks(const unsigned char *blocks, const unsigned long long number)
+{
+  static const bool useExtensions = SHAExtensions::isAvailable();
+
+  if(useExtensions)
+  {
+    SHAExtensions::sha256(m_state, blocks, number);
+    return;
+  }
+
+  for(unsigned long long i = 0; i < number; ++i)
+  {
+    SHA256::process_block(blocks + (i * 64));
+  }
 }
 
 //----------------------------------------------------------------
 void SHA256::process_block(const unsigned char* char_block)
 {
-  unsigned long a, b, c, d, e, f, g, h, temp1, temp2;
-  unsigned long expanded_blk[64];
+  std::uint32_t a, b, c, d, e, f, g, h, temp1, temp2;
+  std::uint32_t expanded_blk[64];
   unsigned int loop;
 
   // Rotational shift to the right
-  auto ROTR = [](unsigned long x, unsigned int n) { return (((x & 0xFFFFFFFF) >> n) | (x << (32 - n))); };
+  auto ROTR = [](std::uint32_t x, unsigned int n) { return static_cast<std::uint32_t>((x >> n) | (x << (32 - n))); };
 
   // Shift to the right
-  auto SHR = [](unsigned long x, unsigned int n) { return ((x & 0xFFFFFFFF) >> n); };
+  auto SHR = [](std::uint32_t x, unsigned int n) { return (x >> n); };
 
   // SHA-256 uses six functions. As they do not depend on loop index we could inline them.
-  auto SHA256_F1 = [](unsigned long x, unsigned long y, unsigned long z) { return ((x & y) | (z & (x | y))); };
-  auto SHA256_F2 = [](unsigned long x, unsigned long y, unsigned long z) { return (z ^ (x & (y ^ z))); };
-  auto SHA256_F3 = [ROTR](unsigned long x) { return (ROTR(x, 2) ^ ROTR(x,13) ^ ROTR(x,22)); };
-  auto SHA256_F4 = [ROTR](unsigned long x) { return (ROTR(x, 6) ^ ROTR(x,11) ^ ROTR(x,25)); };
-  auto SHA256_F5 = [ROTR, SHR](unsigned long x) { return (ROTR(x, 7) ^ ROTR(x,18) ^  SHR(x, 3)); };
-  auto SHA256_F6 = [ROTR, SHR](unsigned long x) { return (ROTR(x,17) ^ ROTR(x,19) ^  SHR(x,10)); };
-
-  // convert the block from unsigned char to unsigned long
+  auto SHA256_F1 = [](std::uint32_t x, std::uint32_t y, std::uint32_t z) { return ((x & y) | (z & (x | y))); };
+  auto SHA256_F2 = [](std::uint32_t x, std::uint32_t y, std::uint32_t z) { return (z ^ (x & (y ^ z))); };
+  auto SHA256_F3 = [ROTR](std::uint32_t x) { return (ROTR(x, 2) ^ ROTR(x,13) ^ ROTR(x,22)); };
+  auto SHA256_F4 = [ROTR](std::uint32_t x) { return (ROTR(x, 6) ^ ROTR(x,11) ^ ROTR(x,25)); };
+  auto SHA256_F5 = [ROTR, SHR](std::uint32_t x) { return (ROTR(x, 7) ^ ROTR(x,18) ^  SHR(x, 3)); };
+  auto SHA256_F6 = [ROTR, SHR](std::uint32_t x) { return (ROTR(x,17) ^ ROTR(x,19) ^  SHR(x,10)); };
+
+  // convert the block from unsigned char to 32 bits words
   for (loop = 0; loop < 16; loop++)
   {
-    expanded_blk[loop] = ((unsigned long) (char_block[(loop*4)]   << 24)) |
-                         ((unsigned long) (char_block[(loop*4)+1] << 16)) |
-                         ((unsigned long) (char_block[(loop*4)+2] <<  8)) |
-                         ((unsigned long) (char_block[(loop*4)+3]));
+    expanded_blk[loop] = (static_cast<std::uint32_t>(char_block[(loop*4)])   << 24) |
+                         (static_cast<std::uint32_t>(char_block[(loop*4)+1]) << 16) |
+                         (static_cast<std::uint32_t>(char_block[(loop*4)+2]) <<  8) |
+                         (static_cast<std::uint32_t>(char_block[(loop*4)+3]));
   }
 
   // expanding the block from 16 to 80
@@ -93,14 +112,14 @@ void SHA256::process_block(const unsigned char* char_block)
   }
 
   // initialize working variables for this block
-  a = SHA256_A;
-  b = SHA256_B;
-  c = SHA256_C;
-  d = SHA256_D;
-  e = SHA256_E;
-  f = SHA256_F;
-  g = SHA256_G;
-  h = SHA256_H;
+  a = m_state[0];
+  b = m_state[1];
+  c = m_state[2];
+  d = m_state[3];
+  e = m_state[4];
+  f = m_state[5];
+  g = m_state[6];
+  h = m_state[7];
 
 
   // process block
@@ -120,25 +139,27 @@ void SHA256::process_block(const unsigned char* char_block)
   }
 
   // set the hash value for next block
-  SHA256_A += a;
-  SHA256_B += b;
-  SHA256_C += c;
-  SHA256_D += d;
-  SHA256_E += e;
-  SHA256_F += f;
-  SHA256_G += g;
-  SHA256_H += h;
+  m_state[0] += a;
+  m_state[1] += b;
+  m_state[2] += c;
+  m_state[3] += d;
+  m_state[4] += e;
+  m_state[5] += f;
+  m_state[6] += g;
+  m_state[7] += h;
 }
 
 //----------------------------------------------------------------
 void SHA256::reset()
 {
-  SHA256_A = 0x6a09e667;
-  SHA256_B = 0xbb67ae85;
-  SHA256_C = 0x3c6ef372;
-  SHA256_D = 0xa54ff53a;
-  SHA256_E = 0x510e527f;
-  SHA256_F = 0x9b05688c;
-  SHA256_G = 0x1f83d9ab;
-  SHA256_H = 0x5be0cd19;
+  Hash::reset();
+
+  m_state[0] = 0x6a09e667;
+  m_state[1] = 0xbb67ae85;
+  m_state[2] = 0x3c6ef372;
+  m_state[3] = 0xa54ff53a;
+  m_state[4] = 0x510e527f;
+  m_state[5] = 0x9b05688c;
+  m_state[6] = 0x1f83d9ab;
+  m_state[7] = 0x5be0cd19;
 }
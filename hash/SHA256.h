@@ -47,20 +47,20 @@ class SHA256
     virtual const QString name() const override
     { return QString("SHA-256"); }
 
+    virtual Algorithms::Id algorithm() const override
+    { return Algorithms::Id::SHA256; }
+
     virtual void reset() override;
 
   private:
+    friend class SHA256MultiBuffer;
+    friend class SHAExtensionsTest;
+
+    virtual void process_blocks(const unsigned char *blocks, const unsigned long long number) override;
+
     virtual void process_block(const unsigned char *char_block) override;
 
-    /** chaining variables. */
-    unsigned long SHA256_A;
-    unsigned long SHA256_B;
-    unsigned long SHA256_C;
-    unsigned long SHA256_D;
-    unsigned long SHA256_E;
-    unsigned long SHA256_F;
-    unsigned long SHA256_G;
-    unsigned long SHA256_H;
+    std::uint32_t m_state[8]; /** chaining variables. */
 };
 
 #endif // HASH_SHA256_H_
@@ -0,0 +1,280 @@
+/*
+ File: SHA256MultiBuffer.cpp
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Project
+#include <hash/SHA256MultiBuffer.h>
+#include <hash/SHA256.h>
+#include <hash/SHAExtensions.h>
+#include <CPUFeatures.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SHA256_MULTIBUFFER_KERNEL
+#include <immintrin.h>
+#endif
+
+#ifdef SHA256_MULTIBUFFER_KERNEL
+
+/** SHA-256 Constants */
+static const std::uint32_t SHA256_CONSTANTS[64] =
+{
+  0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+  0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+  0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+  0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+  0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+  0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+  0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+  0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+/** \brief Rotational shift to the right of the 32 bits values.
+ * \param[in] x values.
+ * \param[in] n number of bits.
+ *
+ */
+__attribute__((target("avx2"), always_inline))
+static inline __m256i ROTR(const __m256i x, const int n)
+{
+  return _mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - n));
+}
+
+/** \brief Transposes the 8x8 matrix of 32 bits values.
+ * \param[inout] r rows of the matrix.
+ *
+ */
+__attribute__((target("avx2"), always_inline))
+static inline void transpose(__m256i r[8])
+{
+  __m256i t[8], u[8];
+
+  for(int i = 0; i < 8; i += 2)
+  {
+    t[i]   = _mm256_unpacklo_epi32(r[i], r[i+1]);
+    t[i+1] = _mm256_unpackhi_epi32(r[i], r[i+1]);
+  }
+
+  for(int i = 0; i < 8; i += 4)
+  {
+    u[i]   = _mm256_unpacklo_epi64(t[i],   t[i+2]);
+    u[i+1] = _mm256_unpackhi_epi64(t[i],   t[i+2]);
+    u[i+2] = _mm256_unpacklo_epi64(t[i+1], t[i+3]);
+    u[i+3] = _mm256_unpackhi_epi64(t[i+1], t[i+3]);
+  }
+
+  for(int i = 0; i < 4; ++i)
+  {
+    r[i]   = _mm256_permute2x128_si256(u[i], u[i+4], 0x20);
+    r[i+4] = _mm256_permute2x128_si256(u[i], u[i+4], 0x31);
+  }
+}
+
+/** \brief Processes one block of each lane.
+ * \param[inout] state chaining variables, one row per variable and one column per lane.
+ * \param[in] blocks data block of each lane.
+ *
+ */
+__attribute__((target("avx2")))
+static void processBlocks(std::uint32_t state[8][SHA256MultiBuffer::LANES], const unsigned char *const blocks[SHA256MultiBuffer::LANES])
+{
+  const __m256i BSWAP = _mm256_set_epi8(12,13,14,15, 8,9,10,11, 4,5,6,7, 0,1,2,3,
+                                        12,13,14,15, 8,9,10,11, 4,5,6,7, 0,1,2,3);
+  __m256i w[16];
+
+  // load the blocks as one register per message word.
+  for(int half = 0; half < 2; ++half)
+  {
+    __m256i *rows = w + 8 * half;
+    for(int lane = 0; lane < 8; ++lane)
+    {
+      rows[lane] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(blocks[lane] + 32 * half));
+    }
+
+    transpose(rows);
+
+    for(int i = 0; i < 8; ++i)
+    {
+      rows[i] = _mm256_shuffle_epi8(rows[i], BSWAP);
+    }
+  }
+
+  __m256i v[8];
+  for(int i = 0; i < 8; ++i)
+  {
+    v[i] = _mm256_load_si256(reinterpret_cast<const __m256i *>(state[i]));
+  }
+
+  auto a = v[0], b = v[1], c = v[2], d = v[3], e = v[4], f = v[5], g = v[6], h = v[7];
+
+#pragma GCC unroll 64
+  for(int loop = 0; loop < 64; ++loop)
+  {
+    auto &word = w[loop & 15];
+
+    // expanding the block in place as only the last 16 words are needed.
+    if(loop >= 16)
+    {
+      const auto w2  = w[(loop - 2) & 15];
+      const auto w15 = w[(loop - 15) & 15];
+      const auto s1  = _mm256_xor_si256(_mm256_xor_si256(ROTR(w2, 17), ROTR(w2, 19)), _mm256_srli_epi32(w2, 10));
+      const auto s0  = _mm256_xor_si256(_mm256_xor_si256(ROTR(w15, 7), ROTR(w15, 18)), _mm256_srli_epi32(w15, 3));
+
+      word = _mm256_add_epi32(_mm256_add_epi32(word, s0), _mm256_add_epi32(w[(loop - 7) & 15], s1));
+    }
+
+    const auto S1   = _mm256_xor_si256(_mm256_xor_si256(ROTR(e, 6), ROTR(e, 11)), ROTR(e, 25));
+    const auto ch   = _mm256_xor_si256(g, _mm256_and_si256(e, _mm256_xor_si256(f, g)));
+    const auto S0   = _mm256_xor_si256(_mm256_xor_si256(ROTR(a, 2), ROTR(a, 13)), ROTR(a, 22));
+    const auto maj  = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b)));
+    const auto kw   = _mm256_add_epi32(word, _mm256_set1_epi32(SHA256_CONSTANTS[loop]));
+
+    const auto temp1 = _mm256_add_epi32(_mm256_add_epi32(h, S1), _mm256_add_epi32(ch, kw));
+    const auto temp2 = _mm256_add_epi32(S0, maj);
+
+    h = g;
+    g = f;
+    f = e;
+    e = _mm256_add_epi32(d, temp1);
+    d = c;
+    c = b;
+    b = a;
+    a = _mm256_add_epi32(temp1, temp2);
+  }
+
+  v[0] = _mm256_add_epi32(v[0], a);
+  v[1] = _mm256_add_epi32(v[1], b);
+  v[2] = _mm256_add_epi32(v[2], c);
+  v[3] = _mm256_add_epi32(v[3], d);
+  v[4] = _mm256_add_epi32(v[4], e);
+  v[5] = _mm256_add_epi32(v[5], f);
+  v[6] = _mm256_add_epi32(v[6], g);
+  v[7] = _mm256_add_epi32(v[7], h);
+
+  for(int i = 0; i < 8; ++i)
+  {
+    _mm256_store_si256(reinterpret_cast<__m256i *>(state[i]), v[i]);
+  }
+}
+
+#endif // SHA256_MULTIBUFFER_KERNEL
+
+//----------------------------------------------------------------
+bool SHA256MultiBuffer::isAvailable()
+{
+#ifdef SHA256_MULTIBUFFER_KERNEL
+  // a single message with the SHA extensions is faster than eight lanes.
+  return CPUFeatures::hasAVX2() && !SHAExtensions::isAvailable();
+#else
+  return false;
+#endif
+}
+
+//----------------------------------------------------------------
+void SHA256MultiBuffer::update(SHA256 *const hashes[], const unsigned char *const data[], const unsigned long long lengths[], const int number)
+{
+  int next = 0;
+
+#ifdef SHA256_MULTIBUFFER_KERNEL
+  // the idle lanes hash this block and their results are discarded.
+  alignas(32) static const unsigned char IDLE_BLOCK[64] = {};
+  alignas(32) std::uint32_t state[8][LANES];
+  const unsigned char *blocks[LANES];
+  int message[LANES];
+  unsigned long long offset[LANES];
+
+  // returns the lane message to its hash object with the bytes that haven't been processed.
+  auto release = [&](const int lane)
+  {
+    auto hash = hashes[message[lane]];
+    for(int i = 0; i < 8; ++i)
+    {
+      hash->m_state[i] = state[i][lane];
+    }
+    hash->m_messageLength += offset[lane];
+    hash->update(data[message[lane]] + offset[lane], lengths[message[lane]] - offset[lane]);
+
+    message[lane] = -1;
+  };
+
+  for(int lane = 0; lane < LANES; ++lane)
+  {
+    message[lane] = -1;
+  }
+
+  while(true)
+  {
+    int active = 0;
+
+    for(int lane = 0; lane < LANES; ++lane)
+    {
+      // fill the empty lanes with the next messages that have at least one complete block.
+      while(message[lane] == -1 && next < number)
+      {
+        const auto hash = hashes[next];
+        if(hash->m_bufferLength == 0 && lengths[next] >= 64)
+        {
+          message[lane] = next;
+          offset[lane]  = 0;
+          for(int i = 0; i < 8; ++i)
+          {
+            state[i][lane] = hash->m_state[i];
+          }
+        }
+        else
+        {
+          hash->update(data[next], lengths[next]);
+        }
+
+        ++next;
+      }
+
+      if(message[lane] != -1) ++active;
+    }
+
+    // a few lanes don't make up for the lost ones, the single message code is faster.
+    if(active < LANES / 2)
+    {
+      for(int lane = 0; lane < LANES; ++lane)
+      {
+        if(message[lane] != -1) release(lane);
+      }
+      break;
+    }
+
+    for(int lane = 0; lane < LANES; ++lane)
+    {
+      blocks[lane] = (message[lane] == -1) ? IDLE_BLOCK : data[message[lane]] + offset[lane];
+    }
+
+    processBlocks(state, blocks);
+
+    for(int lane = 0; lane < LANES; ++lane)
+    {
+      if(message[lane] == -1) continue;
+
+      offset[lane] += 64;
+      if(lengths[message[lane]] - offset[lane] < 64) release(lane);
+    }
+  }
+#endif
+
+  for(; next < number; ++next)
+  {
+    hashes[next]->update(data[next], lengths[next]);
+  }
+}
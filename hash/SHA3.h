@@ -0,0 +1,136 @@
+/*
+ File: SHA3.h
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HASH_SHA3_H_
+#define HASH_SHA3_H_
+
+// Project
+#include <hash/Keccak.h>
+
+/** \class SHA3_256
+ * \brief Implements the Secure Hash Algorithm 3 of 256 bits.
+ *
+ */
+class SHA3_256
+: public Keccak
+{
+  public:
+    /** \brief SHA3_256 class constructor.
+     *
+     */
+    SHA3_256()
+    : Keccak{136, 0x06, 32}
+    {};
+
+    virtual const QString name() const override
+    { return QString("SHA3-256"); }
+
+    virtual Algorithms::Id algorithm() const override
+    { return Algorithms::Id::SHA3_256; }
+};
+
+/** \class SHA3_384
+ * \brief Implements the Secure Hash Algorithm 3 of 384 bits.
+ *
+ */
+class SHA3_384
+: public Keccak
+{
+  public:
+    /** \brief SHA3_384 class constructor.
+     *
+     */
+    SHA3_384()
+    : Keccak{104, 0x06, 48}
+    {};
+
+    virtual const QString name() const override
+    { return QString("SHA3-384"); }
+
+    virtual Algorithms::Id algorithm() const override
+    { return Algorithms::Id::SHA3_384; }
+};
+
+/** \class SHA3_512
+ * \brief Implements the Secure Hash Algorithm 3 of 512 bits.
+ *
+ */
+class SHA3_512
+: public Keccak
+{
+  public:
+    /** \brief SHA3_512 class constructor.
+     *
+     */
+    SHA3_512()
+    : Keccak{72, 0x06, 64}
+    {};
+
+    virtual const QString name() const override
+    { return QString("SHA3-512"); }
+
+    virtual Algorithms::Id algorithm() const override
+    { return Algorithms::Id::SHA3_512; }
+};
+
+/** \class SHAKE128
+ * \brief Implements the SHAKE128 extendable output function with an output of 256 bits.
+ *
+ */
+class SHAKE128
+: public Keccak
+{
+  public:
+    /** \brief SHAKE128 class constructor.
+     *
+     */
+    SHAKE128()
+    : Keccak{168, 0x1F, 32}
+    {};
+
+    virtual const QString name() const override
+    { return QString("SHAKE128"); }
+
+    virtual Algorithms::Id algorithm() const override
+    { return Algorithms::Id::SHAKE128; }
+};
+
+/** \class SHAKE256
+ * \brief Implements the SHAKE256 extendable output function with an output of 512 bits.
+ *
+ */
+class SHAKE256
+: public Keccak
+{
+  public:
+    /** \brief SHAKE256 class constructor.
+     *
+     */
+    SHAKE256()
+    : Keccak{136, 0x1F, 64}
+    {};
+
+    virtual const QString name() const override
+    { return QString("SHAKE256"); }
+
+    virtual Algorithms::Id algorithm() const override
+    { return Algorithms::Id::SHAKE256; }
+};
+
+#endif // HASH_SHA3_H_
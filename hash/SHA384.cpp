@@ -19,12 +19,18 @@
 
 // Project
 #include <hash/SHA384.h>
+#include <CPUFeatures.h>
 
 // C++
 #include <cstring>
 
-/** SHA-384 Constants */
-static const unsigned long long SHA384_CONSTANTS[80] =
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SHA384_AVX2_KERNEL
+#include <immintrin.h>
+#endif
+
+/** SHA-384 and SHA-512 Constants */
+alignas(32) static const unsigned long long SHA384_CONSTANTS[80] =
 {
   0x428A2F98D728AE22LL, 0x7137449123EF65CDLL, 0xB5C0FBCFEC4D3B2FLL, 0xE9B5DBA58189DBBCLL,
   0x3956C25BF348B538LL, 0x59F111F1B605D019LL, 0x923F82A4AF194F9BLL, 0xAB1C5ED5DA6D8118LL,
@@ -48,6 +54,127 @@ static const unsigned long long SHA384_CONSTANTS[80] =
   0x4CC5D4BECB3E42B6LL, 0x597F299CFC657E2ALL, 0x5FCB6FAB3AD6FAECLL, 0x6C44198C4A475817LL
 };
 
+#ifdef SHA384_AVX2_KERNEL
+
+/** \brief Rotational shift to the right of the 64 bits values.
+ * \param[in] x values.
+ * \param[in] n number of bits.
+ *
+ */
+__attribute__((target("avx2"), always_inline))
+static inline __m256i ROTR(const __m256i x, const int n)
+{
+  return _mm256_or_si256(_mm256_srli_epi64(x, n), _mm256_slli_epi64(x, 64 - n));
+}
+
+/** \brief Returns the four words that start one word after the first of the given ones.
+ * \param[in] lo first four words.
+ * \param[in] hi next four words.
+ *
+ */
+__attribute__((target("avx2"), always_inline))
+static inline __m256i shiftWords(const __m256i lo, const __m256i hi)
+{
+  return _mm256_permute4x64_epi64(_mm256_blend_epi32(lo, hi, 0x03), 0x39);
+}
+
+/** \brief SHA-512 small sigma 0 function on four words.
+ * \param[in] x values.
+ *
+ */
+__attribute__((target("avx2"), always_inline))
+static inline __m256i sigma0(const __m256i x)
+{
+  return _mm256_xor_si256(_mm256_xor_si256(ROTR(x, 1), ROTR(x, 8)), _mm256_srli_epi64(x, 7));
+}
+
+/** \brief SHA-512 small sigma 1 function on four words.
+ * \param[in] x values.
+ *
+ */
+__attribute__((target("avx2"), always_inline))
+static inline __m256i sigma1(const __m256i x)
+{
+  return _mm256_xor_si256(_mm256_xor_si256(ROTR(x, 19), ROTR(x, 61)), _mm256_srli_epi64(x, 6));
+}
+
+/** \brief Updates the chaining variables with the given blocks, the message schedule of each
+ * block is computed four words at a time and the rounds use the BMI2 rotations.
+ * \param[inout] state chaining variables.
+ * \param[in] blocks data buffer.
+ * \param[in] number number of 128 bytes blocks in the buffer.
+ *
+ */
+__attribute__((target("avx2,bmi2")))
+static void processBlocksAVX2(unsigned long long state[8], const unsigned char *blocks, const unsigned long long number)
+{
+  const __m256i BSWAP = _mm256_set_epi8(8,9,10,11,12,13,14,15, 0,1,2,3,4,5,6,7,
+                                        8,9,10,11,12,13,14,15, 0,1,2,3,4,5,6,7);
+  alignas(32) unsigned long long wk[80];
+
+  auto ROTR64 = [](unsigned long long x, unsigned int n) { return ((x >> n) | (x << (64 - n))); };
+
+  for(unsigned long long i = 0; i < number; ++i, blocks += 128)
+  {
+    __m256i w[4];
+    for(int j = 0; j < 4; ++j)
+    {
+      w[j] = _mm256_shuffle_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(blocks + 32 * j)), BSWAP);
+      _mm256_store_si256(reinterpret_cast<__m256i *>(wk + 4 * j), _mm256_add_epi64(w[j], _mm256_load_si256(reinterpret_cast<const __m256i *>(SHA384_CONSTANTS + 4 * j))));
+    }
+
+    // the second pair of words depends on the first one through sigma1.
+    for(int loop = 16; loop < 80; loop += 4)
+    {
+      const auto partial = _mm256_add_epi64(_mm256_add_epi64(w[0], shiftWords(w[2], w[3])), sigma0(shiftWords(w[0], w[1])));
+      const auto low     = _mm256_add_epi64(partial, sigma1(_mm256_permute4x64_epi64(w[3], 0xEE)));
+      const auto high    = _mm256_add_epi64(partial, sigma1(_mm256_permute4x64_epi64(low, 0x44)));
+
+      w[0] = w[1];
+      w[1] = w[2];
+      w[2] = w[3];
+      w[3] = _mm256_blend_epi32(low, high, 0xF0);
+
+      _mm256_store_si256(reinterpret_cast<__m256i *>(wk + loop), _mm256_add_epi64(w[3], _mm256_load_si256(reinterpret_cast<const __m256i *>(SHA384_CONSTANTS + loop))));
+    }
+
+    auto a = state[0], b = state[1], c = state[2], d = state[3];
+    auto e = state[4], f = state[5], g = state[6], h = state[7];
+
+    // Maj(a,b,c) reuses the b^c value of the previous round.
+    auto bc = b ^ c;
+
+#pragma GCC unroll 80
+    for(int loop = 0; loop < 80; ++loop)
+    {
+      const auto ab    = a ^ b;
+      const auto temp1 = h + wk[loop] + (ROTR64(e,14) ^ ROTR64(e,18) ^ ROTR64(e,41)) + (g ^ (e & (f ^ g)));
+      const auto temp2 = (ROTR64(a,28) ^ ROTR64(a,34) ^ ROTR64(a,39)) + (b ^ (ab & bc));
+
+      bc = ab;
+      h = g;
+      g = f;
+      f = e;
+      e = d + temp1;
+      d = c;
+      c = b;
+      b = a;
+      a = temp1 + temp2;
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+  }
+}
+
+#endif // SHA384_AVX2_KERNEL
+
 //----------------------------------------------------------------
 SHA384::SHA384()
 : Hash{}
@@ -63,52 +190,60 @@ const int SHA384::blockSize() const
 }
 
 //----------------------------------------------------------------
-const int SHA384::bitsPerUnit() const
+void SHA384::process_blocks(const unsigned char *blocks, const unsigned long long number)
 {
-  return 8;
-}
+#ifdef SHA384_AVX2_KERNEL
+  static const bool useAVX2 = CPUFeatures::hasAVX2() && CPUFeatures::hasBMI2();
 
-//----------------------------------------------------------------
-void SHA384::update(const QByteArray& buffer, const unsigned long long message_length)
-{
-  auto length = buffer.length();
-
-  if (128 == length)
+  if(useAVX2)
   {
-    process_block(reinterpret_cast<const unsigned char *>(buffer.constData()));
+    processBlocksAVX2(m_state, blocks, number);
     return;
   }
+#endif
 
-  QByteArray finalBuffer{128,0};
-  std::memcpy(finalBuffer.data(), buffer.constData(), buffer.length());
-  finalBuffer[length++] = 0x80;
+  for(unsigned long long i = 0; i < number; ++i)
+  {
+    SHA384::process_block(blocks + (i * 128));
+  }
+}
+
+//----------------------------------------------------------------
+void SHA384::finalize()
+{
+  auto length = m_bufferLength;
+  m_buffer[length++] = 0x80;
 
-  // if length < 112 there is space for message length, we process 1 block
+  // if length <= 112 there is space for message length, we process 1 block
   // if not, we need to process two blocks
-  if (length >= 112)
+  if (length > 112)
   {
-    process_block(reinterpret_cast<const unsigned char *>(finalBuffer.constData()));
-    std::memset(finalBuffer.data(), 0x00, 128);
+    std::memset(m_buffer + length, 0x00, 128 - length);
+    process_block(m_buffer);
+    length = 0;
   }
 
+  std::memset(m_buffer + length, 0x00, 120 - length);
+
+  const auto bits = m_messageLength * 8;
   for (unsigned int loop = 0; loop < 8; loop++)
   {
-    finalBuffer[112+loop] = 0x00;
-    finalBuffer[120+loop] = static_cast<unsigned char>(((message_length) >> (56 - (8 * loop))) & 0xFF);
+    m_buffer[120+loop] = static_cast<unsigned char>((bits >> (56 - (8 * loop))) & 0xFF);
   }
 
-  process_block(reinterpret_cast<const unsigned char *>(finalBuffer.constData()));
+  process_block(m_buffer);
+  m_bufferLength = 0;
 }
 
 //----------------------------------------------------------------
 const QString SHA384::value() const
 {
-  return QString("%1 %2 %3\n%4 %5 %6").arg(SHA384_A, 16, 16, QChar('0'))
-                                      .arg(SHA384_B, 16, 16, QChar('0'))
-                                      .arg(SHA384_C, 16, 16, QChar('0'))
-                                      .arg(SHA384_D, 16, 16, QChar('0'))
-                                      .arg(SHA384_E, 16, 16, QChar('0'))
-                                      .arg(SHA384_F, 16, 16, QChar('0'));
+  return QString("%1 %2 %3\n%4 %5 %6").arg(m_state[0], 16, 16, QChar('0'))
+                                      .arg(m_state[1], 16, 16, QChar('0'))
+                                      .arg(m_state[2], 16, 16, QChar('0'))
+                                      .arg(m_state[3], 16, 16, QChar('0'))
+                                      .arg(m_state[4], 16, 16, QChar('0'))
+                                      .arg(m_state[5], 16, 16, QChar('0'));
 }
 
 //----------------------------------------------------------------
@@ -119,10 +254,10 @@ void SHA384::process_block(const unsigned char* char_block)
   unsigned int loop;
 
   // Rotational shift to the right
-  auto ROTR = [](unsigned long long x, unsigned int n) { return (((x & 0xFFFFFFFFFFFFFFFFLL) >> n) | (x << (64 - n))); };
+  auto ROTR = [](unsigned long long x, unsigned int n) { return ((x >> n) | (x << (64 - n))); };
 
   // Shift to the right
-  auto SHR = [](unsigned long long x, unsigned int n) { return ((x & 0xFFFFFFFFFFFFFFFFLL) >> n); };
+  auto SHR = [](unsigned long long x, unsigned int n) { return (x >> n); };
 
   // SHA-384 uses six functions.
   auto SHA384_F1 = [](unsigned long long x, unsigned long long y, unsigned long long z) { return ((x & y) | (z & (x | y))); };
@@ -155,14 +290,14 @@ void SHA384::process_block(const unsigned char* char_block)
   }
 
   // initialize working variables for this block
-  a = SHA384_A;
-  b = SHA384_B;
-  c = SHA384_C;
-  d = SHA384_D;
-  e = SHA384_E;
-  f = SHA384_F;
-  g = SHA384_G;
-  h = SHA384_H;
+  a = m_state[0];
+  b = m_state[1];
+  c = m_state[2];
+  d = m_state[3];
+  e = m_state[4];
+  f = m_state[5];
+  g = m_state[6];
+  h = m_state[7];
 
   // process block
   for (loop = 0; loop < 80; loop++)
@@ -181,25 +316,27 @@ void SHA384::process_block(const unsigned char* char_block)
   }
 
   // set the hash value for next block
-  SHA384_A += a;
-  SHA384_B += b;
-  SHA384_C += c;
-  SHA384_D += d;
-  SHA384_E += e;
-  SHA384_F += f;
-  SHA384_G += g;
-  SHA384_H += h;
+  m_state[0] += a;
+  m_state[1] += b;
+  m_state[2] += c;
+  m_state[3] += d;
+  m_state[4] += e;
+  m_state[5] += f;
+  m_state[6] += g;
+  m_state[7] += h;
 }
 
 //----------------------------------------------------------------
 void SHA384::reset()
 {
-  SHA384_A = 0xCBBB9D5DC1059ED8LL;
-  SHA384_B = 0x629A292A367CD507LL;
-  SHA384_C = 0x9159015A3070DD17LL;
-  SHA384_D = 0x152FECD8F70E5939LL;
-  SHA384_E = 0x67332667FFC00B31LL;
-  SHA384_F = 0x8EB44A8768581511LL;
-  SHA384_G = 0xDB0C2E0D64F98FA7LL;
-  SHA384_H = 0x47B5481DBEFA4FA4LL;
+  Hash::reset();
+
+  m_state[0] = 0xCBBB9D5DC1059ED8LL;
+  m_state[1] = 0x629A292A367CD507LL;
+  m_state[2] = 0x9159015A3070DD17LL;
+  m_state[3] = 0x152FECD8F70E5939LL;
+  m_state[4] = 0x67332667FFC00B31LL;
+  m_state[5] = 0x8EB44A8768581511LL;
+  m_state[6] = 0xDB0C2E0D64F98FA7LL;
+  m_state[7] = 0x47B5481DBEFA4FA4LL;
 }
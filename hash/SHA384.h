@@ -24,7 +24,8 @@
 #include <Hash.h>
 
 /** \class SHA384
- * \brief Implementation of the Secure Hash Algorithm 2 of 384 bits
+ * \brief Implementation of the Secure Hash Algorithm 2 of 384 bits. The compression function
+ *        is shared with the SHA-512, that only differs in the initial values and the digest length.
  */
 class SHA384
 : public Hash
@@ -36,33 +37,29 @@ class SHA384
 
     virtual const int blockSize() const;
 
-    virtual const int bitsPerUnit() const;
-
     virtual const QString value() const;
 
     virtual const QString name() const
     { return QString("SHA-384"); }
 
+    virtual Algorithms::Id algorithm() const
+    { return Algorithms::Id::SHA384; }
+
     virtual void reset();
 
-    virtual void update(const QByteArray &buffer, const unsigned long long message_length);
+    virtual void finalize();
+
+  protected:
+    unsigned long long m_state[8]; /** chaining variables. */
 
   private:
+    virtual void process_blocks(const unsigned char *blocks, const unsigned long long number);
+
     /** \brief Updates the hash with the char block passed as argument.
      * \param[in] char_block data buffer at maximum 128 bytes in size.
      *
      */
-    virtual void process_block(const unsigned char *char_block);
-
-    /** chaining variables. */
-    unsigned long long int SHA384_A;
-    unsigned long long int SHA384_B;
-    unsigned long long int SHA384_C;
-    unsigned long long int SHA384_D;
-    unsigned long long int SHA384_E;
-    unsigned long long int SHA384_F;
-    unsigned long long int SHA384_G;
-    unsigned long long int SHA384_H;
+    void process_block(const unsigned char *char_block);
 };
 
 #endif // HASH_SHA384_H_
@@ -47,20 +47,10 @@ class SHA512
     virtual const QString name() const override
     { return QString("SHA-512"); }
 
-    virtual void reset() override;
-
-  private:
-    virtual void process_block(const unsigned char *char_block) override;
+    virtual Algorithms::Id algorithm() const override
+    { return Algorithms::Id::SHA512; }
 
-    /** chaining variables. */
-    unsigned long long SHA512_A;
-    unsigned long long SHA512_B;
-    unsigned long long SHA512_C;
-    unsigned long long SHA512_D;
-    unsigned long long SHA512_E;
-    unsigned long long SHA512_F;
-    unsigned long long SHA512_G;
-    unsigned long long SHA512_H;
+    virtual void reset() override;
 };
 
 #endif // HASH_SHA512_H_
@@ -0,0 +1,86 @@
+/*
+ File: SHA512t.cpp
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Project
+#include <hash/SHA512t.h>
+
+//----------------------------------------------------------------
+SHA512_256::SHA512_256()
+: SHA384{}
+{
+  // Initialize chaining variables.
+  reset();
+}
+
+//----------------------------------------------------------------
+const QString SHA512_256::value() const
+{
+  return QString("%1 %2 %3 %4").arg(m_state[0], 16, 16, QChar('0'))
+                               .arg(m_state[1], 16, 16, QChar('0'))
+                               .arg(m_state[2], 16, 16, QChar('0'))
+                               .arg(m_state[3], 16, 16, QChar('0'));
+}
+
+//----------------------------------------------------------------
+void SHA512_256::reset()
+{
+  Hash::reset();
+
+  m_state[0] = 0x22312194FC2BF72CLL;
+  m_state[1] = 0x9F555FA3C84C64C2LL;
+  m_state[2] = 0x2393B86B6F53B151LL;
+  m_state[3] = 0x963877195940EABDLL;
+  m_state[4] = 0x96283EE2A88EFFE3LL;
+  m_state[5] = 0xBE5E1E2553863992LL;
+  m_state[6] = 0x2B0199FC2C85B8AALL;
+  m_state[7] = 0x0EB72DDC81C52CA2LL;
+}
+
+//----------------------------------------------------------------
+SHA512_224::SHA512_224()
+: SHA384{}
+{
+  // Initialize chaining variables.
+  reset();
+}
+
+//----------------------------------------------------------------
+const QString SHA512_224::value() const
+{
+  // the last word is truncated to its 32 most significant bits.
+  return QString("%1 %2 %3 %4").arg(m_state[0], 16, 16, QChar('0'))
+                               .arg(m_state[1], 16, 16, QChar('0'))
+                               .arg(m_state[2], 16, 16, QChar('0'))
+                               .arg(m_state[3] >> 32, 8, 16, QChar('0'));
+}
+
+//----------------------------------------------------------------
+void SHA512_224::reset()
+{
+  Hash::reset();
+
+  m_state[0] = 0x8C3D37C819544DA2LL;
+  m_state[1] = 0x73E1996689DCD4D6LL;
+  m_state[2] = 0x1DFAB7AE32FF9C82LL;
+  m_state[3] = 0x679DD514582F9FCFLL;
+  m_state[4] = 0x0F6D2B697BD44DA8LL;
+  m_state[5] = 0x77E36F7304C48942LL;
+  m_state[6] = 0x3F9D85A86A1D36C8LL;
+  m_state[7] = 0x1112E6AD91D692A1LL;
+}
@@ -0,0 +1,89 @@
+/*
+ File: SHA512t.h
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HASH_SHA512T_H_
+#define HASH_SHA512T_H_
+
+// Project
+#include <hash/SHA384.h>
+
+/** \class SHA512_256
+ * \brief Implementation of the SHA-512/256, the SHA-512 with different initial values and
+ *        the digest truncated to 256 bits. It's faster than the SHA-256 on 64 bits processors
+ *        without the SHA extensions.
+ *
+ */
+class SHA512_256
+: public SHA384
+{
+  public:
+    /** \brief SHA512_256 class constructor.
+     *
+     */
+    SHA512_256();
+
+    /** \brief SHA512_256 class virtual destructor.
+     *
+     */
+    virtual ~SHA512_256()
+    {};
+
+    virtual const QString value() const override;
+
+    virtual const QString name() const override
+    { return QString("SHA-512/256"); }
+
+    virtual Algorithms::Id algorithm() const override
+    { return Algorithms::Id::SHA512_256; }
+
+    virtual void reset() override;
+};
+
+/** \class SHA512_224
+ * \brief Implementation of the SHA-512/224, the SHA-512 with different initial values and
+ *        the digest truncated to 224 bits.
+ *
+ */
+class SHA512_224
+: public SHA384
+{
+  public:
+    /** \brief SHA512_224 class constructor.
+     *
+     */
+    SHA512_224();
+
+    /** \brief SHA512_224 class virtual destructor.
+     *
+     */
+    virtual ~SHA512_224()
+    {};
+
+    virtual const QString value() const override;
+
+    virtual const QString name() const override
+    { return QString("SHA-512/224"); }
+
+    virtual Algorithms::Id algorithm() const override
+    { return Algorithms::Id::SHA512_224; }
+
+    virtual void reset() override;
+};
+
+#endif // HASH_SHA512T_H_
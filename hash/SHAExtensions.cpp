@@ -0,0 +1,195 @@
+/*
+ File: SHAExtensions.cpp
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Project
+#include <hash/SHAExtensions.h>
+#include <CPUFeatures.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SHA_EXTENSIONS_KERNELS
+#include <immintrin.h>
+#endif
+
+#ifdef SHA_EXTENSIONS_KERNELS
+
+/** SHA-256 Constants */
+alignas(16) static const std::uint32_t SHA256_CONSTANTS[64] =
+{
+  0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+  0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+  0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+  0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+  0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+  0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+  0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+  0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+//----------------------------------------------------------------
+__attribute__((target("sha,sse4.1")))
+static void sha1Kernel(std::uint32_t state[5], const unsigned char *blocks, unsigned long long number)
+{
+  // the instructions work with the words in reverse order.
+  const __m128i MASK = _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+
+  __m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(state)), 0x1B);
+  __m128i e0   = _mm_set_epi32(state[4], 0, 0, 0);
+  __m128i e1, msg[4];
+
+  for(unsigned long long i = 0; i < number; ++i, blocks += 64)
+  {
+    const auto abcdSave = abcd;
+    const auto eSave    = e0;
+
+    // each group computes 4 rounds, the message schedule is computed 3 groups ahead.
+#pragma GCC unroll 20
+    for(int group = 0; group < 20; ++group)
+    {
+      auto &w   = msg[group % 4];
+      auto &cur = (group % 2 == 0) ? e0 : e1;
+      auto &nxt = (group % 2 == 0) ? e1 : e0;
+
+      if(group < 4)
+      {
+        w = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(blocks + 16 * group)), MASK);
+      }
+
+      cur = (group == 0) ? _mm_add_epi32(cur, w) : _mm_sha1nexte_epu32(cur, w);
+      nxt = abcd;
+
+      if(group >= 3 && group <= 18)
+      {
+        msg[(group + 1) % 4] = _mm_sha1msg2_epu32(msg[(group + 1) % 4], w);
+      }
+
+      switch(group / 5)
+      {
+        case 0:  abcd = _mm_sha1rnds4_epu32(abcd, cur, 0); break;
+        case 1:  abcd = _mm_sha1rnds4_epu32(abcd, cur, 1); break;
+        case 2:  abcd = _mm_sha1rnds4_epu32(abcd, cur, 2); break;
+        default: abcd = _mm_sha1rnds4_epu32(abcd, cur, 3); break;
+      }
+
+      if(group >= 1 && group <= 16)
+      {
+        msg[(group + 3) % 4] = _mm_sha1msg1_epu32(msg[(group + 3) % 4], w);
+      }
+
+      if(group >= 2 && group <= 17)
+      {
+        msg[(group + 2) % 4] = _mm_xor_si128(msg[(group + 2) % 4], w);
+      }
+    }
+
+    e0   = _mm_sha1nexte_epu32(e0, eSave);
+    abcd = _mm_add_epi32(abcd, abcdSave);
+  }
+
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(state), _mm_shuffle_epi32(abcd, 0x1B));
+  state[4] = _mm_extract_epi32(e0, 3);
+}
+
+//----------------------------------------------------------------
+__attribute__((target("sha,sse4.1")))
+static void sha256Kernel(std::uint32_t state[8], const unsigned char *blocks, unsigned long long number)
+{
+  const __m128i MASK = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+  // the instructions use the state as ABEF and CDGH.
+  auto tmp     = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(state)), 0xB1);
+  auto state1  = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(state + 4)), 0x1B);
+  auto state0  = _mm_alignr_epi8(tmp, state1, 8);
+  state1       = _mm_blend_epi16(state1, tmp, 0xF0);
+  __m128i msg[4];
+
+  for(unsigned long long i = 0; i < number; ++i, blocks += 64)
+  {
+    const auto abefSave = state0;
+    const auto cdghSave = state1;
+
+    // each group computes 4 rounds, the message schedule is computed 3 groups ahead.
+#pragma GCC unroll 16
+    for(int group = 0; group < 16; ++group)
+    {
+      auto &w = msg[group % 4];
+
+      if(group < 4)
+      {
+        w = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(blocks + 16 * group)), MASK);
+      }
+
+      auto words = _mm_add_epi32(w, _mm_load_si128(reinterpret_cast<const __m128i *>(SHA256_CONSTANTS + 4 * group)));
+      state1 = _mm_sha256rnds2_epu32(state1, state0, words);
+
+      if(group >= 3 && group <= 14)
+      {
+        auto &next = msg[(group + 1) % 4];
+        next = _mm_add_epi32(next, _mm_alignr_epi8(w, msg[(group + 3) % 4], 4));
+        next = _mm_sha256msg2_epu32(next, w);
+      }
+
+      words  = _mm_shuffle_epi32(words, 0x0E);
+      state0 = _mm_sha256rnds2_epu32(state0, state1, words);
+
+      if(group >= 1 && group <= 12)
+      {
+        msg[(group + 3) % 4] = _mm_sha256msg1_epu32(msg[(group + 3) % 4], w);
+      }
+    }
+
+    state0 = _mm_add_epi32(state0, abefSave);
+    state1 = _mm_add_epi32(state1, cdghSave);
+  }
+
+  tmp    = _mm_shuffle_epi32(state0, 0x1B);
+  state1 = _mm_shuffle_epi32(state1, 0xB1);
+  state0 = _mm_blend_epi16(tmp, state1, 0xF0);
+  state1 = _mm_alignr_epi8(state1, tmp, 8);
+
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(state), state0);
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(state + 4), state1);
+}
+
+#endif // SHA_EXTENSIONS_KERNELS
+
+//----------------------------------------------------------------
+bool SHAExtensions::isAvailable()
+{
+#ifdef SHA_EXTENSIONS_KERNELS
+  return CPUFeatures::hasSHA();
+#else
+  return false;
+#endif
+}
+
+//----------------------------------------------------------------
+void SHAExtensions::sha1(std::uint32_t state[5], const unsigned char *blocks, unsigned long long number)
+{
+#ifdef SHA_EXTENSIONS_KERNELS
+  sha1Kernel(state, blocks, number);
+#endif
+}
+
+//----------------------------------------------------------------
+void SHAExtensions::sha256(std::uint32_t state[8], const unsigned char *blocks, unsigned long long number)
+{
+#ifdef SHA_EXTENSIONS_KERNELS
+  sha256Kernel(state, blocks, number);
+#endif
+}
@@ -0,0 +1,51 @@
+/*
+ File: SHAExtensions.h
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HASH_SHAEXTENSIONS_H_
+#define HASH_SHAEXTENSIONS_H_
+
+// C++
+#include <cstdint>
+
+/** SHA-1 and SHA-256 block functions using the x86 SHA extensions. */
+namespace SHAExtensions
+{
+  /** \brief Returns true if the kernels have been compiled and the processor supports them.
+   *
+   */
+  bool isAvailable();
+
+  /** \brief Updates the SHA-1 chaining variables with the given number of 64 bytes blocks.
+   * \param[inout] state SHA-1 chaining variables.
+   * \param[in] blocks data buffer.
+   * \param[in] number number of blocks in the buffer.
+   *
+   */
+  void sha1(std::uint32_t state[5], const unsigned char *blocks, unsigned long long number);
+
+  /** \brief Updates the SHA-256 or SHA-224 chaining variables with the given number of 64 bytes blocks.
+   * \param[inout] state SHA-256 chaining variables.
+   * \param[in] blocks data buffer.
+   * \param[in] number number of blocks in the buffer.
+   *
+   */
+  void sha256(std::uint32_t state[8], const unsigned char *blocks, unsigned long long number);
+}
+
+#endif // HASH_SHAEXTENSIONS_H_
@@ -0,0 +1,239 @@
+/*
+ File: Tiger.cpp
+ Created on: 05/06/2016
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Project
+#include <hash/Tiger.h>
+
+// C++
+#include <cstring>
+
+namespace
+{
+  /** 512 bits (64 chars) "random value" for the generation of the s-boxes. */
+  constexpr char RANDOM_VALUE[] = "Tiger - A Fast New Hash Function, by Ross Anderson and Eli Biham";
+
+  constexpr int PASSES_NUMBER = 5; /** number of passes for table generation.           */
+  constexpr int BLOCK_PASSES  = 3; /** number of passes when processing the data block. */
+
+  /** \struct TigerTable
+   * \brief The four s-boxes of 256 values.
+   *
+   */
+  struct TigerTable
+  {
+    unsigned long long values[1024]; /** s-boxes values. */
+  };
+
+  /** \brief Updates the chaining variables with the given block.
+   * \param[in] table s-boxes values.
+   * \param[inout] hash_a chaining variable a.
+   * \param[inout] hash_b chaining variable b.
+   * \param[inout] hash_c chaining variable c.
+   * \param[in] data block of 8 words.
+   *
+   */
+  constexpr void compress(const unsigned long long *table, unsigned long long &hash_a, unsigned long long &hash_b, unsigned long long &hash_c, const unsigned long long *data)
+  {
+    unsigned long long block[8] = { data[0], data[1], data[2], data[3], data[4], data[5], data[6], data[7] };
+    unsigned long long a = hash_a, b = hash_b, c = hash_c;
+
+    // processing, PASSES is 3 or more
+    for(int pass_number = 0; pass_number < BLOCK_PASSES; pass_number++)
+    {
+      // if it's not our first pass, key schedule
+      if(pass_number != 0)
+      {
+        block[0] -= block[7] ^ 0xA5A5A5A5A5A5A5A5LL;
+        block[1] ^= block[0];
+        block[2] += block[1];
+        block[3] -= block[2] ^ ((~block[1]) << 19);
+        block[4] ^= block[3];
+        block[5] += block[4];
+        block[6] -= block[5] ^ ((~block[4]) >> 23);
+        block[7] ^= block[6];
+        block[0] += block[7];
+        block[1] -= block[0] ^ ((~block[7]) << 19);
+        block[2] ^= block[1];
+        block[3] += block[2];
+        block[4] -= block[3] ^ ((~block[2]) >> 23);
+        block[5] ^= block[4];
+        block[6] += block[5];
+        block[7] -= block[6] ^ 0x0123456789ABCDEFLL;
+      }
+
+      const int mult = (pass_number == 0) ? 5 : ((pass_number == 1) ? 7 : 9);
+
+      // the real work
+      for(int loop = 0; loop < 8; loop++)
+      {
+        c ^= block[loop];
+        a -= table[  0 + ( c        & 0xFF)] ^
+             table[256 + ((c >> 16) & 0xFF)] ^
+             table[512 + ((c >> 32) & 0xFF)] ^
+             table[768 + ((c >> 48) & 0xFF)];
+        b += table[768 + ((c >>  8) & 0xFF)] ^
+             table[512 + ((c >> 24) & 0xFF)] ^
+             table[256 + ((c >> 40) & 0xFF)] ^
+             table[  0 + ((c >> 56) & 0xFF)];
+        b *= mult;
+
+        const auto temp = a;
+        a = b;
+        b = c;
+        c = temp;
+      }
+    }
+
+    // feed forward
+    hash_a = a ^ hash_a;
+    hash_b = b - hash_b;
+    hash_c = c + hash_c;
+  }
+
+  /** \brief Generates the Tiger s-boxes at compile time. The table is seen as an array of bytes
+   * in little endian order, the bytes of each column are swapped using the chaining variables
+   * of the hash of the random value as indexes.
+   *
+   */
+  constexpr TigerTable generateTable()
+  {
+    TigerTable table{};
+    unsigned long long message[8]{};
+    unsigned long long state[3] = { 0x0123456789abcdefULL, 0xfedcba9876543210ULL, 0xf096a5b4c3b2e187ULL };
+
+    for(int loop = 0; loop < 64; loop++)
+    {
+      message[loop / 8] |= static_cast<unsigned long long>(static_cast<unsigned char>(RANDOM_VALUE[loop])) << (8 * (loop % 8));
+    }
+
+    // fill the table
+    for(int loop = 0; loop < 1024; loop++)
+    {
+      table.values[loop] = static_cast<unsigned long long>(loop & 0xFF) * 0x0101010101010101ULL;
+    }
+
+    int abc = 2;
+
+    // generation
+    for(int passes = 0; passes < PASSES_NUMBER; passes++)
+    {
+      for(int loop = 0; loop < 256; loop++)
+      {
+        for(int sb = 0; sb < 1024; sb += 256)
+        {
+          ++abc;
+          if(abc == 3)
+          {
+            abc = 0;
+            compress(table.values, state[0], state[1], state[2], message);
+          }
+
+          for(int column = 0; column < 8; column++)
+          {
+            const auto mask  = 0xFFULL << (8 * column);
+            const auto other = sb + ((state[abc] >> (8 * column)) & 0xFF);
+            const auto value = table.values[sb + loop] & mask;
+
+            table.values[sb + loop] = (table.values[sb + loop] & ~mask) | (table.values[other] & mask);
+            table.values[other]     = (table.values[other] & ~mask) | value;
+          }
+        }
+      }
+    }
+
+    return table;
+  }
+
+  alignas(64) constexpr TigerTable TIGER_TABLE = generateTable(); /** tiger table values. */
+}
+
+//----------------------------------------------------------------
+Tiger::Tiger()
+: Hash{}
+{
+  // initialize chaining variables
+  reset();
+}
+
+//----------------------------------------------------------------
+const int Tiger::blockSize() const
+{
+  return 64;
+}
+
+//----------------------------------------------------------------
+void Tiger::process_blocks(const unsigned char *blocks, const unsigned long long number)
+{
+  for(unsigned long long i = 0; i < number; ++i)
+  {
+    process_block(blocks + (i * 64));
+  }
+}
+
+//----------------------------------------------------------------
+void Tiger::finalize()
+{
+  auto length = m_bufferLength;
+
+  // padding the message
+  m_buffer[length++] = 0x01;
+
+  // is this block too big? if so fill zeroes, process and make another
+  if(length > 56)
+  {
+    std::memset(m_buffer + length, 0x00, 64 - length);
+    process_block(m_buffer);
+    length = 0;
+  }
+
+  std::memset(m_buffer + length, 0x00, 56 - length);
+
+  // insert message length at the end of block
+  ((unsigned long long*)(&(m_buffer[56])))[0] = m_messageLength<<3;
+
+  process_block(m_buffer);
+  m_bufferLength = 0;
+}
+
+//----------------------------------------------------------------
+const QString Tiger::value() const
+{
+  return QString("%1 %2 %3").arg(hash.a, 16, 16, QChar('0'))
+                            .arg(hash.b, 16, 16, QChar('0'))
+                            .arg(hash.c, 16, 16, QChar('0'));
+}
+
+//----------------------------------------------------------------
+void Tiger::process_block(const unsigned char* char_block)
+{
+  unsigned long long block[8];
+  std::memcpy(block, char_block, sizeof(block));
+
+  compress(TIGER_TABLE.values, hash.a, hash.b, hash.c, block);
+}
+
+//----------------------------------------------------------------
+void Tiger::reset()
+{
+  Hash::reset();
+
+  hash.a = 0x0123456789abcdefULL;
+  hash.b = 0xfedcba9876543210ULL;
+  hash.c = 0xf096a5b4c3b2e187ULL;
+}
@@ -44,36 +44,27 @@ class Tiger
 
     virtual const int blockSize() const;
 
-    virtual const int bitsPerUnit() const;
-
     virtual const QString value() const;
 
     virtual const QString name() const
     { return QString("Tiger"); }
 
+    virtual Algorithms::Id algorithm() const
+    { return Algorithms::Id::TIGER; }
+
     virtual void reset();
 
-    virtual void update(const QByteArray &buffer, const unsigned long long message_length);
+    virtual void finalize();
 
   private:
+    virtual void process_blocks(const unsigned char *blocks, const unsigned long long number);
+
     /** \brief Updates the hash with the char block passed as argument.
      * \param[in] char_block data buffer at maximum 64 bytes in size.
      *
      */
     void process_block(const unsigned char *char_block);
 
-    /** \brief Helper method to generate the Tiger table.
-     * \param[in] message seed.
-     * \param[in] passes_number number of passes.
-     *
-     */
-    void generate_table(const unsigned char *message, const unsigned int passes_number);
-
-    static QString RANDOM_VALUE;    /** seed for table generation.                               */
-    static int     PASSES_NUMBER;   /** number of passes for table generation.                   */
-    static int     BLOCK_PASSES;    /** number of passes when processing the data block.         */
-    static bool    TABLE_AVAILABLE; /** true if the table has been computed and false otherwise. */
-
     typedef struct
     {
         unsigned long long a;
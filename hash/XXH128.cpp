@@ -0,0 +1,186 @@
+/*
+ File: XXH128.cpp
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Project
+#include <hash/XXH128.h>
+
+/** Maximum length of the inputs hashed without stripes. */
+static const unsigned long long MIDSIZE_MAX = 240;
+
+//----------------------------------------------------------------
+XXH128::XXH128()
+: XXH3{}
+{
+  reset();
+}
+
+//----------------------------------------------------------------
+const QString XXH128::value() const
+{
+  return QString("%1 %2 %3 %4").arg(static_cast<std::uint32_t>(m_high >> 32), 8, 16, QChar('0'))
+                               .arg(static_cast<std::uint32_t>(m_high), 8, 16, QChar('0'))
+                               .arg(static_cast<std::uint32_t>(m_low >> 32), 8, 16, QChar('0'))
+                               .arg(static_cast<std::uint32_t>(m_low), 8, 16, QChar('0'));
+}
+
+//----------------------------------------------------------------
+void XXH128::reset()
+{
+  XXH3::reset();
+
+  m_low  = 0;
+  m_high = 0;
+}
+
+//----------------------------------------------------------------
+void XXH128::mix32(const unsigned char *first, const unsigned char *second, const unsigned char *secret)
+{
+  m_low  += mix16(first, secret);
+  m_low  ^= read64(second) + read64(second + 8);
+  m_high += mix16(second, secret + 16);
+  m_high ^= read64(first) + read64(first + 8);
+}
+
+//----------------------------------------------------------------
+void XXH128::finalizeMidsize()
+{
+  const auto length = m_messageLength;
+  const auto data   = m_buffer;
+
+  m_low  = length * PRIME64_1;
+  m_high = 0;
+
+  if(length > 128)
+  {
+    const int rounds = length / 32;
+
+    for(int i = 0; i < 4; ++i)
+    {
+      mix32(data + 32 * i, data + 32 * i + 16, SECRET + 32 * i);
+    }
+
+    m_low  = avalanche(m_low);
+    m_high = avalanche(m_high);
+    for(int i = 4; i < rounds; ++i)
+    {
+      mix32(data + 32 * i, data + 32 * i + 16, SECRET + 32 * (i - 4) + 3);
+    }
+
+    mix32(data + length - 16, data + length - 32, SECRET + 136 - 17 - 16);
+  }
+  else
+  {
+    if(length > 32)
+    {
+      if(length > 64)
+      {
+        if(length > 96)
+        {
+          mix32(data + 48, data + length - 64, SECRET + 96);
+        }
+        mix32(data + 32, data + length - 48, SECRET + 64);
+      }
+      mix32(data + 16, data + length - 32, SECRET + 32);
+    }
+    mix32(data, data + length - 16, SECRET);
+  }
+
+  const auto low  = m_low + m_high;
+  const auto high = (m_low * PRIME64_1) + (m_high * PRIME64_4) + (length * PRIME64_2);
+
+  m_low  = avalanche(low);
+  m_high = 0 - avalanche(high);
+}
+
+//----------------------------------------------------------------
+void XXH128::finalize()
+{
+  const auto length = m_messageLength;
+  const auto data   = m_buffer;
+
+  if(length > MIDSIZE_MAX)
+  {
+    finalizeStripes();
+    m_low  = mergeAccumulators(SECRET + 11, length * PRIME64_1);
+    m_high = mergeAccumulators(SECRET + SECRET_SIZE - 64 - 11, ~(length * PRIME64_2));
+    return;
+  }
+
+  if(length > 16)
+  {
+    finalizeMidsize();
+    return;
+  }
+
+  if(length > 8)
+  {
+    const auto flipLow  = read64(SECRET + 32) ^ read64(SECRET + 40);
+    const auto flipHigh = read64(SECRET + 48) ^ read64(SECRET + 56);
+    const auto inputLow = read64(data);
+    auto inputHigh      = read64(data + length - 8);
+
+    auto product = static_cast<unsigned __int128>(inputLow ^ inputHigh ^ flipLow) * PRIME64_1;
+    auto low  = static_cast<std::uint64_t>(product) + ((length - 1) << 54);
+    auto high = static_cast<std::uint64_t>(product >> 64);
+
+    inputHigh ^= flipHigh;
+    high += inputHigh + static_cast<std::uint64_t>(static_cast<std::uint32_t>(inputHigh)) * (PRIME32_2 - 1);
+    low  ^= __builtin_bswap64(high);
+
+    product = static_cast<unsigned __int128>(low) * PRIME64_2;
+    m_low   = avalanche(static_cast<std::uint64_t>(product));
+    m_high  = avalanche(static_cast<std::uint64_t>(product >> 64) + high * PRIME64_2);
+    return;
+  }
+
+  if(length >= 4)
+  {
+    const std::uint64_t input = read32(data) + (static_cast<std::uint64_t>(read32(data + length - 4)) << 32);
+    const auto keyed = input ^ (read64(SECRET + 16) ^ read64(SECRET + 24));
+
+    const auto product = static_cast<unsigned __int128>(keyed) * (PRIME64_1 + (length << 2));
+    auto low  = static_cast<std::uint64_t>(product);
+    auto high = static_cast<std::uint64_t>(product >> 64);
+
+    high += (low << 1);
+    low  ^= (high >> 3);
+    low  ^= (low >> 35);
+    low  *= 0x9FB21C651E98DF25ULL;
+    low  ^= (low >> 28);
+
+    m_low  = low;
+    m_high = avalanche(high);
+    return;
+  }
+
+  if(length > 0)
+  {
+    const std::uint32_t combinedLow = (static_cast<std::uint32_t>(data[0]) << 16) | (static_cast<std::uint32_t>(data[length >> 1]) << 24) |
+                                      static_cast<std::uint32_t>(data[length - 1]) | (static_cast<std::uint32_t>(length) << 8);
+    const auto swapped = __builtin_bswap32(combinedLow);
+    const std::uint32_t combinedHigh = (swapped << 13) | (swapped >> 19);
+
+    m_low  = avalanche64(combinedLow ^ static_cast<std::uint64_t>(read32(SECRET) ^ read32(SECRET + 4)));
+    m_high = avalanche64(combinedHigh ^ static_cast<std::uint64_t>(read32(SECRET + 8) ^ read32(SECRET + 12)));
+    return;
+  }
+
+  m_low  = avalanche64(read64(SECRET + 64) ^ read64(SECRET + 72));
+  m_high = avalanche64(read64(SECRET + 80) ^ read64(SECRET + 88));
+}
@@ -0,0 +1,77 @@
+/*
+ File: XXH128.h
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HASH_XXH128_H_
+#define HASH_XXH128_H_
+
+// Project
+#include <hash/XXH3.h>
+
+/** \class XXH128
+ * \brief Implements the XXH3 non-cryptographic hash of 128 bits with the default secret and seed.
+ *        Shares the stripes and accumulators with the 64 bits version, only the short inputs
+ *        and the final merge are different.
+ *
+ */
+class XXH128
+: public XXH3
+{
+  public:
+    /** \brief XXH128 class constructor.
+     *
+     */
+    XXH128();
+
+    /** \brief XXH128 class virtual destructor.
+     *
+     */
+    virtual ~XXH128()
+    {};
+
+    virtual const QString value() const override;
+
+    virtual const QString name() const override
+    { return QString("XXH128"); }
+
+    virtual Algorithms::Id algorithm() const override
+    { return Algorithms::Id::XXH128; }
+
+    virtual void reset() override;
+
+    virtual void finalize() override;
+
+  private:
+    /** \brief Mixes 32 bytes of data into the 128 bits accumulator.
+     * \param[in] first first 16 bytes of data.
+     * \param[in] second second 16 bytes of data.
+     * \param[in] secret secret data.
+     *
+     */
+    void mix32(const unsigned char *first, const unsigned char *second, const unsigned char *secret);
+
+    /** \brief Computes the final value of the inputs between 17 and 240 bytes.
+     *
+     */
+    void finalizeMidsize();
+
+    std::uint64_t m_low;  /** low 64 bits of the hash value.  */
+    std::uint64_t m_high; /** high 64 bits of the hash value. */
+};
+
+#endif // HASH_XXH128_H_
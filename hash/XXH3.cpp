@@ -0,0 +1,494 @@
+/*
+ File: XXH3.cpp
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Project
+#include <hash/XXH3.h>
+#include <CPUFeatures.h>
+
+// C++
+#include <algorithm>
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define XXH3_SIMD_KERNELS
+#include <immintrin.h>
+#endif
+
+const std::uint8_t XXH3::SECRET[XXH3::SECRET_SIZE] =
+{
+  0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+  0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+  0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+  0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+  0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+  0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+  0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+  0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+  0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+  0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+  0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+  0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e
+};
+
+/** Number of stripes of a block, each stripe uses the secret 8 bytes further. */
+static const int BLOCK_STRIPES = (192 - 64) / 8;
+
+/** Size of the buffer of the streaming input. */
+static const unsigned long long BUFFER_SIZE = 256;
+
+/** Maximum length of the inputs hashed without stripes. */
+static const unsigned long long MIDSIZE_MAX = 240;
+
+/** Functions to accumulate the stripes and to scramble the accumulators. */
+using AccumulateFunction = void (*)(std::uint64_t acc[8], const unsigned char *data, const unsigned char *secret, const int stripes);
+using ScrambleFunction   = void (*)(std::uint64_t acc[8], const unsigned char *secret);
+
+//----------------------------------------------------------------
+static void accumulateScalar(std::uint64_t acc[8], const unsigned char *data, const unsigned char *secret, const int stripes)
+{
+  for(int stripe = 0; stripe < stripes; ++stripe, data += 64, secret += 8)
+  {
+    for(int i = 0; i < 8; ++i)
+    {
+      std::uint64_t value, key;
+      std::memcpy(&value, data + 8 * i, 8);
+      std::memcpy(&key, secret + 8 * i, 8);
+      key ^= value;
+
+      acc[i ^ 1] += value;
+      acc[i]     += (key & 0xFFFFFFFF) * (key >> 32);
+    }
+  }
+}
+
+#ifdef XXH3_SIMD_KERNELS
+
+//----------------------------------------------------------------
+__attribute__((target("sse2")))
+static void accumulateSSE2(std::uint64_t acc[8], const unsigned char *data, const unsigned char *secret, const int stripes)
+{
+  __m128i a[4];
+  for(int i = 0; i < 4; ++i) a[i] = _mm_load_si128(reinterpret_cast<const __m128i *>(acc) + i);
+
+  for(int stripe = 0; stripe < stripes; ++stripe, data += 64, secret += 8)
+  {
+    for(int i = 0; i < 4; ++i)
+    {
+      const auto value   = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data) + i);
+      const auto key     = _mm_xor_si128(value, _mm_loadu_si128(reinterpret_cast<const __m128i *>(secret) + i));
+      const auto product = _mm_mul_epu32(key, _mm_srli_epi64(key, 32));
+      const auto swapped = _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+
+      a[i] = _mm_add_epi64(_mm_add_epi64(a[i], swapped), product);
+    }
+  }
+
+  for(int i = 0; i < 4; ++i) _mm_store_si128(reinterpret_cast<__m128i *>(acc) + i, a[i]);
+}
+
+//----------------------------------------------------------------
+__attribute__((target("sse2")))
+static void scrambleSSE2(std::uint64_t acc[8], const unsigned char *secret)
+{
+  const auto prime = _mm_set1_epi32(0x9E3779B1U);
+
+  for(int i = 0; i < 4; ++i)
+  {
+    auto a = _mm_load_si128(reinterpret_cast<const __m128i *>(acc) + i);
+    a = _mm_xor_si128(_mm_xor_si128(a, _mm_srli_epi64(a, 47)), _mm_loadu_si128(reinterpret_cast<const __m128i *>(secret) + i));
+
+    const auto low  = _mm_mul_epu32(a, prime);
+    const auto high = _mm_mul_epu32(_mm_shuffle_epi32(a, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+    _mm_store_si128(reinterpret_cast<__m128i *>(acc) + i, _mm_add_epi64(low, _mm_slli_epi64(high, 32)));
+  }
+}
+
+//----------------------------------------------------------------
+__attribute__((target("avx2")))
+static void accumulateAVX2(std::uint64_t acc[8], const unsigned char *data, const unsigned char *secret, const int stripes)
+{
+  __m256i a[2];
+  for(int i = 0; i < 2; ++i) a[i] = _mm256_load_si256(reinterpret_cast<const __m256i *>(acc) + i);
+
+  for(int stripe = 0; stripe < stripes; ++stripe, data += 64, secret += 8)
+  {
+    for(int i = 0; i < 2; ++i)
+    {
+      const auto value   = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data) + i);
+      const auto key     = _mm256_xor_si256(value, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(secret) + i));
+      const auto product = _mm256_mul_epu32(key, _mm256_srli_epi64(key, 32));
+      const auto swapped = _mm256_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+
+      a[i] = _mm256_add_epi64(_mm256_add_epi64(a[i], swapped), product);
+    }
+  }
+
+  for(int i = 0; i < 2; ++i) _mm256_store_si256(reinterpret_cast<__m256i *>(acc) + i, a[i]);
+}
+
+//----------------------------------------------------------------
+__attribute__((target("avx2")))
+static void scrambleAVX2(std::uint64_t acc[8], const unsigned char *secret)
+{
+  const auto prime = _mm256_set1_epi32(0x9E3779B1U);
+
+  for(int i = 0; i < 2; ++i)
+  {
+    auto a = _mm256_load_si256(reinterpret_cast<const __m256i *>(acc) + i);
+    a = _mm256_xor_si256(_mm256_xor_si256(a, _mm256_srli_epi64(a, 47)), _mm256_loadu_si256(reinterpret_cast<const __m256i *>(secret) + i));
+
+    const auto low  = _mm256_mul_epu32(a, prime);
+    const auto high = _mm256_mul_epu32(_mm256_shuffle_epi32(a, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+    _mm256_store_si256(reinterpret_cast<__m256i *>(acc) + i, _mm256_add_epi64(low, _mm256_slli_epi64(high, 32)));
+  }
+}
+
+// GCC 12 warns about the undefined vectors inside its own AVX-512 shift and shuffle intrinsics.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+//----------------------------------------------------------------
+__attribute__((target("avx512f")))
+static void accumulateAVX512(std::uint64_t acc[8], const unsigned char *data, const unsigned char *secret, const int stripes)
+{
+  auto a = _mm512_load_si512(acc);
+
+  for(int stripe = 0; stripe < stripes; ++stripe, data += 64, secret += 8)
+  {
+    const auto value   = _mm512_loadu_si512(data);
+    const auto key     = _mm512_xor_si512(value, _mm512_loadu_si512(secret));
+    const auto product = _mm512_mul_epu32(key, _mm512_srli_epi64(key, 32));
+    const auto swapped = _mm512_shuffle_epi32(value, static_cast<_MM_PERM_ENUM>(_MM_SHUFFLE(1, 0, 3, 2)));
+
+    a = _mm512_add_epi64(_mm512_add_epi64(a, swapped), product);
+  }
+
+  _mm512_store_si512(acc, a);
+}
+
+//----------------------------------------------------------------
+__attribute__((target("avx512f")))
+static void scrambleAVX512(std::uint64_t acc[8], const unsigned char *secret)
+{
+  const auto prime = _mm512_set1_epi32(0x9E3779B1U);
+
+  auto a = _mm512_load_si512(acc);
+  a = _mm512_xor_si512(_mm512_xor_si512(a, _mm512_srli_epi64(a, 47)), _mm512_loadu_si512(secret));
+
+  const auto low  = _mm512_mul_epu32(a, prime);
+  const auto high = _mm512_mul_epu32(_mm512_shuffle_epi32(a, static_cast<_MM_PERM_ENUM>(_MM_SHUFFLE(0, 3, 0, 1))), prime);
+  _mm512_store_si512(acc, _mm512_add_epi64(low, _mm512_slli_epi64(high, 32)));
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#else
+
+//----------------------------------------------------------------
+static void scrambleScalar(std::uint64_t acc[8], const unsigned char *secret)
+{
+  for(int i = 0; i < 8; ++i)
+  {
+    std::uint64_t key;
+    std::memcpy(&key, secret + 8 * i, 8);
+
+    acc[i] = ((acc[i] ^ (acc[i] >> 47)) ^ key) * 0x9E3779B1U;
+  }
+}
+
+#endif // XXH3_SIMD_KERNELS
+
+//----------------------------------------------------------------
+XXH3::XXH3()
+: Hash{}
+{
+  reset();
+}
+
+//----------------------------------------------------------------
+const QString XXH3::value() const
+{
+  return QString("%1 %2").arg(static_cast<std::uint32_t>(m_value >> 32), 8, 16, QChar('0'))
+                         .arg(static_cast<std::uint32_t>(m_value), 8, 16, QChar('0'));
+}
+
+//----------------------------------------------------------------
+void XXH3::reset()
+{
+  Hash::reset();
+
+  const std::uint64_t initial[8] = { PRIME32_3, PRIME64_1, PRIME64_2, PRIME64_3, PRIME64_4, PRIME32_2, PRIME64_5, PRIME32_1 };
+  std::memcpy(m_accumulators, initial, sizeof(m_accumulators));
+  std::memset(m_lastStripe, 0, sizeof(m_lastStripe));
+  m_stripes = 0;
+  m_value   = 0;
+}
+
+//----------------------------------------------------------------
+void XXH3::update(const unsigned char *data, unsigned long long length)
+{
+  m_messageLength += length;
+
+  // the small inputs are hashed completely in the finalization.
+  if(m_bufferLength + length <= BUFFER_SIZE)
+  {
+    std::memcpy(m_buffer + m_bufferLength, data, length);
+    m_bufferLength += length;
+    return;
+  }
+
+  // the data is processed as long as there is more, the last stripe is processed in the finalization.
+  if(m_bufferLength != 0)
+  {
+    const auto bytes = BUFFER_SIZE - m_bufferLength;
+    std::memcpy(m_buffer + m_bufferLength, data, bytes);
+    data += bytes;
+    length -= bytes;
+
+    process_blocks(m_buffer, BUFFER_SIZE / 64);
+    m_bufferLength = 0;
+  }
+
+  const auto stripes = (length - 1) / 64;
+  if(stripes != 0)
+  {
+    process_blocks(data, stripes);
+    data += stripes * 64;
+    length -= stripes * 64;
+  }
+
+  std::memcpy(m_buffer, data, length);
+  m_bufferLength = length;
+}
+
+//----------------------------------------------------------------
+void XXH3::finalize()
+{
+  const auto length = m_messageLength;
+  const auto data   = m_buffer;
+
+  if(length > MIDSIZE_MAX)
+  {
+    finalizeStripes();
+    m_value = mergeAccumulators(SECRET + 11, length * PRIME64_1);
+    return;
+  }
+
+  if(length > 128)
+  {
+    const int rounds = length / 16;
+
+    std::uint64_t acc = length * PRIME64_1;
+    for(int i = 0; i < 8; ++i)
+    {
+      acc += mix16(data + 16 * i, SECRET + 16 * i);
+    }
+
+    acc = avalanche(acc);
+    for(int i = 8; i < rounds; ++i)
+    {
+      acc += mix16(data + 16 * i, SECRET + 16 * (i - 8) + 3);
+    }
+
+    acc += mix16(data + length - 16, SECRET + 136 - 17);
+    m_value = avalanche(acc);
+    return;
+  }
+
+  if(length > 16)
+  {
+    std::uint64_t acc = length * PRIME64_1;
+    if(length > 32)
+    {
+      if(length > 64)
+      {
+        if(length > 96)
+        {
+          acc += mix16(data + 48, SECRET + 96);
+          acc += mix16(data + length - 64, SECRET + 112);
+        }
+        acc += mix16(data + 32, SECRET + 64);
+        acc += mix16(data + length - 48, SECRET + 80);
+      }
+      acc += mix16(data + 16, SECRET + 32);
+      acc += mix16(data + length - 32, SECRET + 48);
+    }
+    acc += mix16(data, SECRET);
+    acc += mix16(data + length - 16, SECRET + 16);
+
+    m_value = avalanche(acc);
+    return;
+  }
+
+  if(length > 8)
+  {
+    const auto low  = read64(data) ^ (read64(SECRET + 24) ^ read64(SECRET + 32));
+    const auto high = read64(data + length - 8) ^ (read64(SECRET + 40) ^ read64(SECRET + 48));
+    const auto acc  = length + __builtin_bswap64(low) + high + multiplyFold(low, high);
+
+    m_value = avalanche(acc);
+    return;
+  }
+
+  if(length >= 4)
+  {
+    const std::uint64_t input = read32(data + length - 4) + (static_cast<std::uint64_t>(read32(data)) << 32);
+    auto value = input ^ (read64(SECRET + 8) ^ read64(SECRET + 16));
+
+    // rrmxmx
+    value ^= ((value << 49) | (value >> 15)) ^ ((value << 24) | (value >> 40));
+    value *= 0x9FB21C651E98DF25ULL;
+    value ^= (value >> 35) + length;
+    value *= 0x9FB21C651E98DF25ULL;
+    value ^= (value >> 28);
+
+    m_value = value;
+    return;
+  }
+
+  if(length > 0)
+  {
+    const std::uint32_t combined = (static_cast<std::uint32_t>(data[0]) << 16) | (static_cast<std::uint32_t>(data[length >> 1]) << 24) |
+                                   static_cast<std::uint32_t>(data[length - 1]) | (static_cast<std::uint32_t>(length) << 8);
+
+    m_value = avalanche64(combined ^ static_cast<std::uint64_t>(read32(SECRET) ^ read32(SECRET + 4)));
+    return;
+  }
+
+  m_value = avalanche64(read64(SECRET + 56) ^ read64(SECRET + 64));
+}
+
+//----------------------------------------------------------------
+void XXH3::finalizeStripes()
+{
+  // the buffer has at least one byte, all but the last stripe are processed.
+  process_blocks(m_buffer, (m_bufferLength - 1) / 64);
+
+  unsigned char stripe[64];
+  if(m_bufferLength >= 64)
+  {
+    std::memcpy(stripe, m_buffer + m_bufferLength - 64, 64);
+  }
+  else
+  {
+    std::memcpy(stripe, m_lastStripe + m_bufferLength, 64 - m_bufferLength);
+    std::memcpy(stripe + 64 - m_bufferLength, m_buffer, m_bufferLength);
+  }
+
+  accumulateScalar(m_accumulators, stripe, SECRET + SECRET_SIZE - 64 - 7, 1);
+}
+
+//----------------------------------------------------------------
+std::uint64_t XXH3::mergeAccumulators(const unsigned char *secret, const std::uint64_t start) const
+{
+  auto result = start;
+  for(int i = 0; i < 4; ++i)
+  {
+    result += multiplyFold(m_accumulators[2 * i] ^ read64(secret + 16 * i), m_accumulators[2 * i + 1] ^ read64(secret + 16 * i + 8));
+  }
+
+  return avalanche(result);
+}
+
+//----------------------------------------------------------------
+void XXH3::process_blocks(const unsigned char *blocks, const unsigned long long number)
+{
+#ifdef XXH3_SIMD_KERNELS
+  static const AccumulateFunction accumulate = CPUFeatures::hasAVX512() ? accumulateAVX512 : (CPUFeatures::hasAVX2() ? accumulateAVX2 : accumulateSSE2);
+  static const ScrambleFunction   scramble   = CPUFeatures::hasAVX512() ? scrambleAVX512   : (CPUFeatures::hasAVX2() ? scrambleAVX2   : scrambleSSE2);
+#else
+  static const AccumulateFunction accumulate = accumulateScalar;
+  static const ScrambleFunction   scramble   = scrambleScalar;
+#endif
+
+  if(number == 0) return;
+
+  auto remaining = number;
+  while(remaining != 0)
+  {
+    const auto stripes = static_cast<int>(std::min<unsigned long long>(remaining, BLOCK_STRIPES - m_stripes));
+    accumulate(m_accumulators, blocks, SECRET + 8 * m_stripes, stripes);
+
+    m_stripes += stripes;
+    blocks    += 64 * stripes;
+    remaining -= stripes;
+
+    if(m_stripes == BLOCK_STRIPES)
+    {
+      scramble(m_accumulators, SECRET + SECRET_SIZE - 64);
+      m_stripes = 0;
+    }
+  }
+
+  std::memcpy(m_lastStripe, blocks - 64, 64);
+}
+
+//----------------------------------------------------------------
+std::uint64_t XXH3::read64(const unsigned char *data)
+{
+  std::uint64_t value;
+  std::memcpy(&value, data, sizeof(value));
+  return value;
+}
+
+//----------------------------------------------------------------
+std::uint32_t XXH3::read32(const unsigned char *data)
+{
+  std::uint32_t value;
+  std::memcpy(&value, data, sizeof(value));
+  return value;
+}
+
+//----------------------------------------------------------------
+std::uint64_t XXH3::multiplyFold(const std::uint64_t a, const std::uint64_t b)
+{
+  const auto product = static_cast<unsigned __int128>(a) * b;
+  return static_cast<std::uint64_t>(product) ^ static_cast<std::uint64_t>(product >> 64);
+}
+
+//----------------------------------------------------------------
+std::uint64_t XXH3::mix16(const unsigned char *data, const unsigned char *secret)
+{
+  return multiplyFold(read64(data) ^ read64(secret), read64(data + 8) ^ read64(secret + 8));
+}
+
+//----------------------------------------------------------------
+std::uint64_t XXH3::avalanche(std::uint64_t value)
+{
+  value ^= value >> 37;
+  value *= 0x165667919E3779F9ULL;
+  value ^= value >> 32;
+  return value;
+}
+
+//----------------------------------------------------------------
+std::uint64_t XXH3::avalanche64(std::uint64_t value)
+{
+  value ^= value >> 33;
+  value *= PRIME64_2;
+  value ^= value >> 29;
+  value *= PRIME64_3;
+  value ^= value >> 32;
+  return value;
+}
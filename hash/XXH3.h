@@ -0,0 +1,145 @@
+/*
+ File: XXH3.h
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HASH_XXH3_H_
+#define HASH_XXH3_H_
+
+// Project
+#include <Hash.h>
+
+// C++
+#include <cstdint>
+
+/** \class XXH3
+ * \brief Implements the XXH3 non-cryptographic hash of 64 bits with the default secret and seed.
+ *        The inputs larger than 240 bytes are processed in stripes of 64 bytes that update eight
+ *        accumulators, the accumulators are scrambled after each block of 16 stripes.
+ *
+ */
+class XXH3
+: public Hash
+{
+  public:
+    /** \brief XXH3 class constructor.
+     *
+     */
+    XXH3();
+
+    /** \brief XXH3 class virtual destructor.
+     *
+     */
+    virtual ~XXH3()
+    {};
+
+    virtual const int blockSize() const override
+    { return 64; }
+
+    virtual const QString value() const override;
+
+    virtual const QString name() const override
+    { return QString("XXH3-64"); }
+
+    virtual Algorithms::Id algorithm() const override
+    { return Algorithms::Id::XXH3; }
+
+    virtual void reset() override;
+
+    virtual void update(const unsigned char *data, const unsigned long long length) override;
+
+    virtual void finalize() override;
+
+  protected:
+    /** \brief Processes the buffered data and the last stripe of an input larger than 240 bytes.
+     *
+     */
+    void finalizeStripes();
+
+    /** \brief Returns the value of the accumulators merged with the given part of the secret.
+     * \param[in] secret secret data.
+     * \param[in] start initial value.
+     *
+     */
+    std::uint64_t mergeAccumulators(const unsigned char *secret, const std::uint64_t start) const;
+
+    /** \brief Returns the little endian 64 bits value of the data.
+     * \param[in] data data buffer.
+     *
+     */
+    static std::uint64_t read64(const unsigned char *data);
+
+    /** \brief Returns the little endian 32 bits value of the data.
+     * \param[in] data data buffer.
+     *
+     */
+    static std::uint32_t read32(const unsigned char *data);
+
+    /** \brief Returns the 64 bits of the 128 bits product of the values folded with a xor.
+     * \param[in] a b values.
+     *
+     */
+    static std::uint64_t multiplyFold(const std::uint64_t a, const std::uint64_t b);
+
+    /** \brief Mixes 16 bytes of data with 16 bytes of the secret.
+     * \param[in] data data buffer.
+     * \param[in] secret secret data.
+     *
+     */
+    static std::uint64_t mix16(const unsigned char *data, const unsigned char *secret);
+
+    /** \brief XXH3 avalanche of the value.
+     * \param[in] value value.
+     *
+     */
+    static std::uint64_t avalanche(std::uint64_t value);
+
+    /** \brief XXH64 avalanche of the value.
+     * \param[in] value value.
+     *
+     */
+    static std::uint64_t avalanche64(std::uint64_t value);
+
+    static const int SECRET_SIZE = 192; /** size of the secret in bytes. */
+
+    static const std::uint8_t SECRET[SECRET_SIZE]; /** default secret. */
+
+    static const std::uint64_t PRIME32_1 = 0x9E3779B1U;
+    static const std::uint64_t PRIME32_2 = 0x85EBCA77U;
+    static const std::uint64_t PRIME32_3 = 0xC2B2AE3DU;
+    static const std::uint64_t PRIME64_1 = 0x9E3779B185EBCA87ULL;
+    static const std::uint64_t PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+    static const std::uint64_t PRIME64_3 = 0x165667B19E3779F9ULL;
+    static const std::uint64_t PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+    static const std::uint64_t PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+    alignas(64) std::uint64_t m_accumulators[8]; /** accumulators of the stripes.                  */
+    int                       m_stripes;         /** number of stripes processed of the block.     */
+    unsigned char             m_lastStripe[64];  /** last processed stripe.                        */
+
+  private:
+    /** \brief Accumulates the given number of stripes, scrambling the accumulators at the end of each block.
+     * \param[in] blocks data buffer.
+     * \param[in] number number of stripes in the buffer.
+     *
+     */
+    virtual void process_blocks(const unsigned char *blocks, const unsigned long long number) override;
+
+    std::uint64_t m_value; /** hash value. */
+};
+
+#endif // HASH_XXH3_H_
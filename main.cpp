@@ -19,6 +19,7 @@
 
 // Project
 #include <SimpleHasher.h>
+#include <CommandLine.h>
 
 // Qt
 #include <QApplication>
@@ -41,6 +42,9 @@ void myMessageOutput(QtMsgType type, const QMessageLogContext &context, const QS
 //-----------------------------------------------------------------
 int main(int argc, char *argv[])
 {
+  // the headless mode doesn't create any widget.
+  if(CommandLine::isRequested(argc, argv)) return CommandLine::run(argc, argv);
+
   QStringList files;
   if(argc != 1)
   {
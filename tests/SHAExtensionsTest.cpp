@@ -0,0 +1,163 @@
+/*
+ File: SHAExtensionsTest.cpp
+ Created on: 17/10/2026
+ Author: Felix de las Pozas Alvarez
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Project
+#include <CPUFeatures.h>
+#include <hash/SHA1.h>
+#include <hash/SHA224.h>
+#include <hash/SHA256.h>
+#include <hash/SHAExtensions.h>
+
+// C++
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+/** Exit code of a skipped test for CTest. */
+static const int SKIP_RETURN_CODE = 77;
+
+/** Block function of the SHA extensions. */
+using Kernel = void (*)(std::uint32_t *, const unsigned char *, unsigned long long);
+
+/** \brief Returns the message padded to a multiple of 64 bytes with the length in bits at the end.
+ * \param[in] message message data.
+ *
+ */
+static std::vector<unsigned char> pad(const std::vector<unsigned char> &message)
+{
+  auto padded = message;
+  padded.push_back(0x80);
+
+  while(padded.size() % 64 != 56) padded.push_back(0x00);
+
+  const unsigned long long bits = message.size() * 8ULL;
+  for(int i = 0; i < 8; ++i)
+  {
+    padded.push_back(static_cast<unsigned char>((bits >> (56 - (8 * i))) & 0xFF));
+  }
+
+  return padded;
+}
+
+/** \class SHAExtensionsTest
+ * \brief Compares the block functions of the SHA extensions with the scalar block functions of
+ *        the SHA-1, SHA-224 and SHA-256 hashes, directly and through the update of the hashes.
+ *
+ */
+class SHAExtensionsTest
+{
+  public:
+    /** \brief Returns the number of mismatches of the given hash for the message.
+     * \param[in] kernel block function of the SHA extensions for the hash.
+     * \param[in] message message data.
+     *
+     */
+    template<class T, int N>
+    static int check(Kernel kernel, const std::vector<unsigned char> &message)
+    {
+      const auto padded = pad(message);
+      const auto blocks = padded.size() / 64;
+      int errors = 0;
+
+      // reference with the scalar block function, one block at a time.
+      T scalar;
+      for(std::size_t i = 0; i < blocks; ++i)
+      {
+        scalar.T::process_block(padded.data() + i * 64);
+      }
+
+      // the kernel processing all the blocks in one call and one block per call.
+      T initial;
+      std::uint32_t whole[N], single[N];
+      std::memcpy(whole,  initial.m_state, sizeof(whole));
+      std::memcpy(single, initial.m_state, sizeof(single));
+
+      kernel(whole, padded.data(), blocks);
+      for(std::size_t i = 0; i < blocks; ++i)
+      {
+        kernel(single, padded.data() + i * 64, 1);
+      }
+
+      errors += report<T>(message.size(), "all blocks",   std::memcmp(whole,  scalar.m_state, sizeof(whole))  != 0);
+      errors += report<T>(message.size(), "single block", std::memcmp(single, scalar.m_state, sizeof(single)) != 0);
+
+      // the updates split the message across the buffered and the complete blocks.
+      for(const std::size_t split: {1, 3, 55, 56, 63, 64, 65, 200})
+      {
+        T hash;
+        for(std::size_t offset = 0; offset < message.size(); offset += split)
+        {
+          hash.update(message.data() + offset, std::min(split, message.size() - offset));
+        }
+        hash.finalize();
+
+        errors += report<T>(message.size(), "split update", std::memcmp(hash.m_state, scalar.m_state, sizeof(hash.m_state)) != 0);
+      }
+
+      return errors;
+    }
+
+  private:
+    /** \brief Prints the mismatch and returns 1, or returns 0 if there is none.
+     * \param[in] length length of the message.
+     * \param[in] method processing method.
+     * \param[in] mismatch true if the states don't match.
+     *
+     */
+    template<class T>
+    static int report(const std::size_t length, const char *method, const bool mismatch)
+    {
+      if(!mismatch) return 0;
+
+      std::printf("%s mismatch, %zu bytes, %s\n", T().name().toLatin1().constData(), length, method);
+      return 1;
+    }
+};
+
+//----------------------------------------------------------------
+int main()
+{
+  if(!CPUFeatures::hasSHA() || !SHAExtensions::isAvailable())
+  {
+    std::printf("The processor doesn't support the SHA extensions, skipped.\n");
+    return SKIP_RETURN_CODE;
+  }
+
+  // lengths around the padding boundaries of one and two blocks, and longer messages.
+  const std::size_t LENGTHS[] = { 0, 1, 3, 54, 55, 56, 57, 63, 64, 65, 118, 119, 120, 121, 127, 128, 129, 1000, 4109 };
+  int errors = 0;
+
+  for(const auto length: LENGTHS)
+  {
+    std::vector<unsigned char> message(length);
+    for(std::size_t i = 0; i < length; ++i)
+    {
+      message[i] = static_cast<unsigned char>(i * 31 + 7);
+    }
+
+    errors += SHAExtensionsTest::check<SHA1,   5>(SHAExtensions::sha1,   message);
+    errors += SHAExtensionsTest::check<SHA224, 8>(SHAExtensions::sha256, message);
+    errors += SHAExtensionsTest::check<SHA256, 8>(SHAExtensions::sha256, message);
+  }
+
+  std::printf("%d mismatches.\n", errors);
+
+  return errors == 0 ? 0 : 1;
+}